@@ -3,6 +3,28 @@
 
 DEFINE_LOG_CATEGORY(LogSatisfactorySplunkMod);
 
+UE_TRACE_CHANNEL_DEFINE(SplunkExporterChannel);
+
+TRACE_DECLARE_INT_COUNTER(SplunkBufferedEvents,   TEXT("SplunkExporter/Buffered Events"));
+TRACE_DECLARE_INT_COUNTER(SplunkBufferedBytes,    TEXT("SplunkExporter/Buffered Bytes"));
+TRACE_DECLARE_INT_COUNTER(SplunkRequestsInFlight, TEXT("SplunkExporter/Requests In Flight"));
+TRACE_DECLARE_INT_COUNTER(SplunkBytesInFlight,    TEXT("SplunkExporter/Bytes In Flight"));
+
+DEFINE_STAT(STAT_SplunkMetricsRead);
+DEFINE_STAT(STAT_SplunkMetricsRecord);
+DEFINE_STAT(STAT_SplunkSweepSlice);
+DEFINE_STAT(STAT_SplunkLayout);
+DEFINE_STAT(STAT_SplunkFlushTimer);
+DEFINE_STAT(STAT_SplunkHttpResponse);
+DEFINE_STAT(STAT_SplunkSubmitWait);
+DEFINE_STAT(STAT_SplunkEncode);
+DEFINE_STAT(STAT_SplunkPipelineFlush);
+DEFINE_STAT(STAT_SplunkCompress);
+DEFINE_STAT(STAT_SplunkBufferedEvents);
+DEFINE_STAT(STAT_SplunkBufferedBytes);
+DEFINE_STAT(STAT_SplunkRequestsInFlight);
+DEFINE_STAT(STAT_SplunkBytesInFlight);
+
 IMPLEMENT_MODULE(FSatisfactorySplunkModModule, SatisfactorySplunkMod);
 
 void FSatisfactorySplunkModModule::StartupModule()
@@ -0,0 +1,139 @@
+#include "SplunkAckTracker.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+FSplunkAckTracker::FSplunkAckTracker(int64 InMaxPendingBytes)
+    : MaxPendingBytes(FMath::Max<int64>(InMaxPendingBytes, 1))
+{
+}
+
+bool FSplunkAckTracker::ParseAckId(const FString& ResponseBody, int64& OutAckId)
+{
+    TSharedPtr<FJsonObject> Json;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ResponseBody), Json) || !Json.IsValid())
+    {
+        return false;
+    }
+    return Json->TryGetNumberField(TEXT("ackId"), OutAckId);
+}
+
+void FSplunkAckTracker::Add(int64 AckId, TArray<uint8>&& Body, bool bGzipped, double Now)
+{
+    if (FBatch* Existing = Pending.Find(AckId))
+    {
+        // Splunk restarted and reused the ID; the old batch's fate is unknown
+        PendingBytes -= Existing->Body.Num();
+        Orphaned.Add(MoveTemp(*Existing));
+        Pending.Remove(AckId);
+    }
+
+    PendingBytes += Body.Num();
+    Pending.Add(AckId, FBatch{ MoveTemp(Body), bGzipped, Now });
+
+    // Oldest first, but never the batch just added
+    while (PendingBytes > MaxPendingBytes && Pending.Num() > 1)
+    {
+        Remove(Pending.CreateConstIterator().Key(), nullptr);
+        EvictedTotal++;
+    }
+}
+
+bool FSplunkAckTracker::BuildPollRequest(TArray<uint8>& OutBody) const
+{
+    if (Pending.Num() == 0) return false;
+
+    FString Request = TEXT("{\"acks\":[");
+    int32 Count = 0;
+    for (const TPair<int64, FBatch>& Entry : Pending)
+    {
+        if (Count == MaxIdsPerPoll) break;
+        if (Count++ > 0)
+        {
+            Request.AppendChar(TEXT(','));
+        }
+        Request.Append(LexToString(Entry.Key));
+    }
+    Request.Append(TEXT("]}"));
+
+    const FTCHARToUTF8 Utf8(*Request);
+    OutBody.Reset(Utf8.Length());
+    OutBody.Append((const uint8*)Utf8.Get(), Utf8.Length());
+    return true;
+}
+
+int32 FSplunkAckTracker::ApplyPollResponse(const FString& ResponseBody)
+{
+    TSharedPtr<FJsonObject> Json;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ResponseBody), Json) || !Json.IsValid())
+    {
+        return 0;
+    }
+
+    const TSharedPtr<FJsonObject>* Acks = nullptr;
+    if (!Json->TryGetObjectField(TEXT("acks"), Acks))
+    {
+        return 0;
+    }
+
+    // {"acks":{"3":true,"4":false}}
+    int32 Released = 0;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*Acks)->Values)
+    {
+        bool bCommitted = false;
+        if (Entry.Value.IsValid() && Entry.Value->TryGetBool(bCommitted) && bCommitted)
+        {
+            const int64 AckId = FCString::Atoi64(*Entry.Key);
+            if (Pending.Contains(AckId))
+            {
+                Remove(AckId, nullptr);
+                Released++;
+            }
+        }
+    }
+    AckedTotal += Released;
+    return Released;
+}
+
+void FSplunkAckTracker::TakeExpired(double Now, double Timeout, TArray<FBatch>& OutBatches)
+{
+    OutBatches.Append(MoveTemp(Orphaned));
+    Orphaned.Reset();
+
+    TArray<int64, TInlineAllocator<16>> Expired;
+    for (const TPair<int64, FBatch>& Entry : Pending)
+    {
+        if (Now - Entry.Value.SentTime > Timeout)
+        {
+            Expired.Add(Entry.Key);
+        }
+    }
+    for (int64 AckId : Expired)
+    {
+        Remove(AckId, &OutBatches);
+    }
+}
+
+void FSplunkAckTracker::TakeAll(TArray<FBatch>& OutBatches)
+{
+    OutBatches.Append(MoveTemp(Orphaned));
+    Orphaned.Reset();
+    for (TPair<int64, FBatch>& Entry : Pending)
+    {
+        OutBatches.Add(MoveTemp(Entry.Value));
+    }
+    Pending.Reset();
+    PendingBytes = 0;
+}
+
+void FSplunkAckTracker::Remove(int64 AckId, TArray<FBatch>* OutBatches)
+{
+    FBatch Batch;
+    if (!Pending.RemoveAndCopyValue(AckId, Batch)) return;
+
+    PendingBytes -= Batch.Body.Num();
+    if (OutBatches)
+    {
+        OutBatches->Add(MoveTemp(Batch));
+    }
+}
@@ -0,0 +1,667 @@
+#include "SplunkBenchmarkCommandlet.h"
+#include "SatisfactorySplunkMod.h"
+#include "SplunkPipeline.h"
+#include "SplunkSample.h"
+#include "SplunkDeltaTracker.h"
+#include "SplunkMachineStore.h"
+#include "SplunkEventEncoders.h"
+#include "SplunkNameCache.h"
+#include "SplunkMetricGroups.h"
+#include "SplunkBuildableRegistry.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeExit.h"
+#include <atomic>
+
+namespace SplunkBenchmark
+{
+    struct FConfig
+    {
+        int32 Manufacturers = 10000;
+        int32 Extractors = 2000;
+        int32 Generators = 1000;
+        int32 Vehicles = 500;
+        int32 Trains = 200;
+        int32 CarsPerTrain = 8;
+        int32 Samples = 10;
+        float ChangeRatio = 0.1f;       // share of machines whose readings move between samples
+        int32 GzipLevel = 6;
+        FString CsvPath;
+    };
+
+    enum class EMode : uint8
+    {
+        Events,
+        Delta,
+        Metrics
+    };
+
+    static const TCHAR* ModeName(EMode Mode)
+    {
+        switch (Mode)
+        {
+            case EMode::Events: return TEXT("events");
+            case EMode::Delta:  return TEXT("events+delta");
+            default:            return TEXT("metrics");
+        }
+    }
+
+    enum class ECollector : uint8
+    {
+        Manufacturers,
+        Extractors,
+        Generators,
+        Vehicles,
+        Trains,
+        Num
+    };
+
+    static const TCHAR* CollectorName(ECollector Collector)
+    {
+        static const TCHAR* Names[] = { TEXT("manufacturers"), TEXT("extractors"), TEXT("generators"), TEXT("vehicles"), TEXT("trains") };
+        return Names[(int32)Collector];
+    }
+
+    // What the exporter's collectors would have read off live actors, with names already interned
+    struct FWorld
+    {
+        TArray<FSplunkMachineReading> Manufacturers;
+        TArray<FSplunkMachineReading> Extractors;
+        TArray<FSplunkMachineReading> Generators;
+        TArray<int32> ManufacturerRecipes;      // index into Recipes per manufacturer
+        TArray<FSplunkRecipeNames> Recipes;
+        TArray<FSplunkVehicleReading> Vehicles;
+        TArray<FSplunkTrainReading> Trains;
+    };
+
+    static FVector RandomLocation(FRandomStream& Random)
+    {
+        return FVector(Random.FRandRange(-300000.0f, 300000.0f), Random.FRandRange(-300000.0f, 300000.0f), Random.FRandRange(-5000.0f, 20000.0f));
+    }
+
+    /** Builds a deterministic world sized by Config, interning its names into Strings. */
+    static void BuildWorld(const FConfig& Config, FSplunkStringTable& Strings, FWorld& World)
+    {
+        FRandomStream Random(1337);
+
+        static const TCHAR* ManufacturerClasses[] = { TEXT("Build_ConstructorMk1_C"), TEXT("Build_AssemblerMk1_C"), TEXT("Build_ManufacturerMk1_C"), TEXT("Build_SmelterMk1_C"), TEXT("Build_FoundryMk1_C"), TEXT("Build_OilRefinery_C") };
+        static const TCHAR* GeneratorClasses[] = { TEXT("Build_GeneratorCoal_C"), TEXT("Build_GeneratorFuel_C"), TEXT("Build_GeneratorNuclear_C"), TEXT("Build_GeneratorBiomass_C") };
+        static const TCHAR* Resources[] = { TEXT("Iron Ore"), TEXT("Copper Ore"), TEXT("Limestone"), TEXT("Coal"), TEXT("Caterium Ore"), TEXT("Raw Quartz"), TEXT("Sulfur"), TEXT("Bauxite"), TEXT("Uranium"), TEXT("Water"), TEXT("Crude Oil") };
+        static const TCHAR* Parts[] = { TEXT("Iron Plate"), TEXT("Iron Rod"), TEXT("Screw"), TEXT("Reinforced Iron Plate"), TEXT("Modular Frame"), TEXT("Steel Beam"), TEXT("Concrete"), TEXT("Wire"), TEXT("Cable"), TEXT("Circuit Board"), TEXT("Computer") };
+
+        auto InternAll = [&Strings](TArrayView<const TCHAR* const> Values)
+        {
+            TArray<int32> Ids;
+            for (const TCHAR* Value : Values)
+            {
+                Ids.Add(Strings.Intern(Value));
+            }
+            return Ids;
+        };
+        const TArray<int32> ManufacturerClassIds = InternAll(ManufacturerClasses);
+        const TArray<int32> GeneratorClassIds = InternAll(GeneratorClasses);
+        const TArray<int32> ResourceIds = InternAll(Resources);
+        const TArray<int32> PartIds = InternAll(Parts);
+        TArray<int32> ItemIds = ResourceIds;
+        ItemIds.Append(PartIds);
+
+        // One recipe per part, from one to three inputs, so events carry secondary_inputs like real ones
+        for (int32 i = 0; i < PartIds.Num(); i++)
+        {
+            FSplunkRecipeNames& Recipe = World.Recipes.AddDefaulted_GetRef();
+            Recipe.RecipeNameId = Strings.Intern(FString::Printf(TEXT("Recipe %s"), Parts[i]));
+            Recipe.Products.Add({ PartIds[i], Random.RandRange(1, 4) });
+            const int32 NumInputs = Random.RandRange(1, 3);
+            for (int32 Input = 0; Input < NumInputs; Input++)
+            {
+                Recipe.Ingredients.Add({ ItemIds[Random.RandHelper(ItemIds.Num())], Random.RandRange(1, 12) });
+            }
+        }
+
+        auto AddMachine = [&Strings, &Random](TArray<FSplunkMachineReading>& Out, const TCHAR* Prefix, int32 Index)
+        {
+            FSplunkMachineReading& Machine = Out.AddDefaulted_GetRef();
+            Machine.NameId = Strings.Add(FString::Printf(TEXT("%s_%d"), Prefix, Index));
+            Machine.Power = Random.FRandRange(4.0f, 75.0f);
+            Machine.Efficiency = Random.FRand() < 0.85f ? Random.FRandRange(0.5f, 1.0f) : 0.0f;
+            Machine.Location = RandomLocation(Random);
+            return &Machine;
+        };
+
+        World.Manufacturers.Reserve(Config.Manufacturers);
+        for (int32 i = 0; i < Config.Manufacturers; i++)
+        {
+            FSplunkMachineReading* Machine = AddMachine(World.Manufacturers, TEXT("Build_ConstructorMk1_C"), i);
+            const int32 RecipeIndex = Random.RandHelper(World.Recipes.Num());
+            Machine->GroupId = ManufacturerClassIds[Random.RandHelper(ManufacturerClassIds.Num())];
+            Machine->Key = RecipeIndex + 1;
+            World.ManufacturerRecipes.Add(RecipeIndex);
+        }
+
+        World.Extractors.Reserve(Config.Extractors);
+        for (int32 i = 0; i < Config.Extractors; i++)
+        {
+            FSplunkMachineReading* Machine = AddMachine(World.Extractors, TEXT("Build_MinerMk2_C"), i);
+            const int32 ResourceIndex = Random.RandHelper(ResourceIds.Num());
+            Machine->GroupId = ResourceIds[ResourceIndex];
+            Machine->Key = ResourceIndex + 1;
+            Machine->Rate = Random.FRandRange(30.0f, 780.0f);
+        }
+
+        World.Generators.Reserve(Config.Generators);
+        for (int32 i = 0; i < Config.Generators; i++)
+        {
+            FSplunkMachineReading* Machine = AddMachine(World.Generators, TEXT("Build_GeneratorCoal_C"), i);
+            Machine->GroupId = GeneratorClassIds[Random.RandHelper(GeneratorClassIds.Num())];
+            Machine->MaxPower = Random.FRandRange(75.0f, 2500.0f);
+            Machine->Power = Machine->MaxPower * Machine->Efficiency;
+            Machine->bProducing = Machine->Efficiency > 0.0f;
+            Machine->FuelStacks = Random.RandRange(0, 2);
+            Machine->FuelEnergy = Machine->FuelStacks * Random.FRandRange(300.0f, 75000.0f);
+        }
+
+        const int32 FuelId = Strings.Intern(TEXT("Packaged Fuel"));
+        World.Vehicles.Reserve(Config.Vehicles);
+        for (int32 i = 0; i < Config.Vehicles; i++)
+        {
+            FSplunkVehicleReading& Vehicle = World.Vehicles.AddDefaulted_GetRef();
+            Vehicle.NameId = Strings.Add(FString::Printf(TEXT("BP_Tractor_C_%d"), i));
+            Vehicle.VehicleType = TEXT("Tractor");
+            Vehicle.bAutomated = Random.FRand() < 0.7f;
+            Vehicle.Location = RandomLocation(Random);
+            Vehicle.Rotation = FRotator(0.0f, Random.FRandRange(-180.0f, 180.0f), 0.0f);
+            Vehicle.Speed = Random.FRandRange(0.0f, 90.0f);
+            Vehicle.MaxSpeed = 90.0f;
+            Vehicle.bHasFuelInventory = true;
+            Vehicle.FuelSlots = 1;
+            Vehicle.FuelItems.Add({ FuelId, Random.RandRange(1, 50), 750.0f });
+            Vehicle.bHasStorage = true;
+            Vehicle.CargoSlots = 25;
+            const int32 CargoStacks = Random.RandRange(0, Vehicle.CargoSlots);
+            for (int32 Stack = 0; Stack < CargoStacks; Stack++)
+            {
+                Vehicle.Cargo.Add({ ItemIds[Random.RandHelper(ItemIds.Num())], 100, 100.0f });
+            }
+            if (Vehicle.bAutomated)
+            {
+                Vehicle.TargetStationId = Strings.Add(FString::Printf(TEXT("Build_TruckStation_C_%d"), Random.RandHelper(64)));
+                Vehicle.DistanceToTarget = Random.FRandRange(0.0f, 200000.0f);
+            }
+        }
+
+        // Multi-car consists: a locomotive at each end, freight wagons in between
+        World.Trains.Reserve(Config.Trains);
+        for (int32 i = 0; i < Config.Trains; i++)
+        {
+            FSplunkTrainReading& Train = World.Trains.AddDefaulted_GetRef();
+            Train.NameId = Strings.Add(FString::Printf(TEXT("FGTrain_%d"), i));
+            Train.Speed = Random.FRandRange(0.0f, 120.0f);
+            Train.ConsistNum = Config.CarsPerTrain;
+            for (int32 c = 0; c < Config.CarsPerTrain; c++)
+            {
+                FSplunkTrainCar& Car = Train.Cars.AddDefaulted_GetRef();
+                Car.Index = c;
+                Car.NameId = Strings.Add(FString::Printf(TEXT("BP_Car_%d_%d"), i, c));
+                Car.Location = RandomLocation(Random);
+                Car.bLocomotive = c == 0 || (c == Config.CarsPerTrain - 1 && Config.CarsPerTrain > 2);
+                Car.bFreight = !Car.bLocomotive;
+                if (Car.bLocomotive)
+                {
+                    Car.PowerConsumption = Random.FRandRange(25.0f, 110.0f);
+                    continue;
+                }
+
+                const int32 CargoItemId = ItemIds[Random.RandHelper(ItemIds.Num())];
+                Car.CargoSlots = 32;
+                Car.CargoBegin = Train.Cargo.Num();
+                Car.CargoNum = Random.RandRange(0, Car.CargoSlots);
+                for (int32 Stack = 0; Stack < Car.CargoNum; Stack++)
+                {
+                    Train.Cargo.Add({ CargoItemId, 100, 0.0f });
+                }
+            }
+            Train.bHasTimeTable = true;
+            Train.TimeTableStations = 4;
+            Train.CurrentStop = Random.RandHelper(Train.TimeTableStations);
+            Train.CurrentStation = FString::Printf(TEXT("Station %d"), Random.RandHelper(64));
+        }
+    }
+
+    /** Moves ChangeRatio of the readings, like a factory between two samples. */
+    static void Mutate(FWorld& World, float ChangeRatio, FRandomStream& Random)
+    {
+        auto MutateMachines = [&](TArray<FSplunkMachineReading>& Machines)
+        {
+            for (FSplunkMachineReading& Machine : Machines)
+            {
+                if (Random.FRand() >= ChangeRatio) continue;
+                Machine.Efficiency = Random.FRand() < 0.85f ? Random.FRandRange(0.5f, 1.0f) : 0.0f;
+                Machine.Power = Machine.MaxPower > 0.0f ? Machine.MaxPower * Machine.Efficiency : Random.FRandRange(4.0f, 75.0f);
+                Machine.bProducing = Machine.MaxPower > 0.0f && Machine.Efficiency > 0.0f;
+            }
+        };
+        MutateMachines(World.Manufacturers);
+        MutateMachines(World.Extractors);
+        MutateMachines(World.Generators);
+
+        // Vehicles and trains move every sample
+        for (FSplunkVehicleReading& Vehicle : World.Vehicles)
+        {
+            Vehicle.Location.X += Vehicle.Speed * 10.0f;
+        }
+        for (FSplunkTrainReading& Train : World.Trains)
+        {
+            for (FSplunkTrainCar& Car : Train.Cars)
+            {
+                Car.Location.X += Train.Speed * 10.0f;
+            }
+        }
+    }
+
+    /**
+     * Forwarding allocator that counts allocations while installed as GMalloc.
+     * Only the count is added; blocks still come from and go back to the inner allocator.
+     */
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+        {
+            Allocations.fetch_add(1, std::memory_order_relaxed);
+            return Inner->Malloc(Count, Alignment);
+        }
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            Allocations.fetch_add(1, std::memory_order_relaxed);
+            return Inner->Realloc(Original, Count, Alignment);
+        }
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual const TCHAR* GetDescriptiveName() override { return TEXT("SplunkBenchmarkCounting"); }
+
+        int64 GetAllocations() const { return Allocations.load(std::memory_order_relaxed); }
+
+    private:
+        FMalloc* Inner;
+        std::atomic<int64> Allocations{ 0 };
+    };
+
+    /** Installs an FCountingMalloc for the lifetime of the scope. */
+    class FScopedAllocationCounter
+    {
+    public:
+        FScopedAllocationCounter() : Previous(GMalloc), Counting(GMalloc) { GMalloc = &Counting; }
+        ~FScopedAllocationCounter() { GMalloc = Previous; }
+
+        int64 GetAllocations() const { return Counting.GetAllocations(); }
+
+    private:
+        FMalloc* Previous;
+        FCountingMalloc Counting;
+    };
+
+    struct FResult
+    {
+        ECollector Collector;
+        EMode Mode;
+        int64 Items = 0;            // actors read, summed over samples
+        int64 Events = 0;
+        double RecordSeconds = 0.0; // game-thread read + record, excluding inline encode
+        int64 EncodeMicros = 0;
+        int64 CompressMicros = 0;
+        int64 Allocations = 0;
+        int64 PayloadBytes = 0;     // before gzip
+        int64 WireBytes = 0;
+    };
+
+    /** One collector in one mode: records every sample through a private inline pipeline. */
+    class FRun
+    {
+    public:
+        FRun(const FConfig& InConfig, ECollector InCollector, EMode InMode)
+            : Config(InConfig)
+            , Pipeline(MakePipelineConfig(InConfig), [this](TArray<uint8>&& Body, bool) { WireBytes += Body.Num(); }, nullptr)
+        {
+            Result.Collector = InCollector;
+            Result.Mode = InMode;
+            Writer.SetStringTable(&Pipeline.GetStringTable());
+        }
+
+        FResult Execute()
+        {
+            BuildWorld(Config, Pipeline.GetStringTable(), World);
+            FRandomStream Random(42);
+
+            for (int32 Sample = 0; Sample < Config.Samples; Sample++)
+            {
+                if (Sample > 0)
+                {
+                    Mutate(World, Config.ChangeRatio, Random);
+                }
+
+                const int64 EncodeBefore = Pipeline.GetEncodeMicros() + Pipeline.GetCompressMicros();
+                const double StartTime = FPlatformTime::Seconds();
+                {
+                    FScopedAllocationCounter Counter;
+                    RecordSample(Sample == 0, 1700000000 + Sample);
+                    Pipeline.RequestFlush();
+                    Result.Allocations += Counter.GetAllocations();
+                }
+                const double Elapsed = FPlatformTime::Seconds() - StartTime;
+                const int64 EncodeMicros = Pipeline.GetEncodeMicros() + Pipeline.GetCompressMicros() - EncodeBefore;
+                Result.RecordSeconds += FMath::Max(Elapsed - EncodeMicros / 1000000.0, 0.0);
+            }
+            Pipeline.Shutdown();
+
+            Result.EncodeMicros = Pipeline.GetEncodeMicros();
+            Result.CompressMicros = Pipeline.GetCompressMicros();
+            Result.PayloadBytes = Pipeline.GetPayloadBytes();
+            Result.WireBytes = WireBytes;
+            return Result;
+        }
+
+    private:
+        static FSplunkPipelineConfig MakePipelineConfig(const FConfig& Config)
+        {
+            FSplunkPipelineConfig PipelineConfig;
+            PipelineConfig.BufferCapacityBytes = 256 * 1024 * 1024;
+            PipelineConfig.GzipCompressionLevel = Config.GzipLevel;
+            return PipelineConfig;
+        }
+
+        void RecordSample(bool bKeyframe, int64 Time)
+        {
+            const bool bMetrics = Result.Mode == EMode::Metrics;
+            FSplunkDeltaTracker* DeltaTracker = Result.Mode == EMode::Delta ? &Deltas : nullptr;
+            switch (Result.Collector)
+            {
+                case ECollector::Manufacturers:
+                    Result.Items += World.Manufacturers.Num();
+                    if (bMetrics)
+                    {
+                        WriteMachineMetrics(World.Manufacturers, false, Time);
+                        break;
+                    }
+                    for (int32 Slot = 0; Slot < World.Manufacturers.Num(); Slot++)
+                    {
+                        Store.Write(Slot, World.Manufacturers[Slot]);
+                        const FSplunkRecipeNames& Recipe = World.Recipes[World.ManufacturerRecipes[Slot]];
+                        if (FSplunkEventEncoders::WriteManufacturerEvent(Writer, Store, Slot, &Recipe, DeltaTracker, Time, bKeyframe))
+                        {
+                            Commit();
+                        }
+                    }
+                    break;
+                case ECollector::Extractors:
+                    Result.Items += World.Extractors.Num();
+                    if (bMetrics)
+                    {
+                        WriteMachineMetrics(World.Extractors, true, Time);
+                        break;
+                    }
+                    for (int32 Slot = 0; Slot < World.Extractors.Num(); Slot++)
+                    {
+                        Store.Write(Slot, World.Extractors[Slot]);
+                        if (FSplunkEventEncoders::WriteExtractorEvent(Writer, Store, Slot, DeltaTracker, Time, bKeyframe))
+                        {
+                            Commit();
+                        }
+                    }
+                    break;
+                case ECollector::Generators:
+                    Result.Items += World.Generators.Num();
+                    if (bMetrics)
+                    {
+                        // The metrics pass only counts generators; their power comes from the circuits
+                        WriteCountMetric(SPLUNK_HEC_KEY("metric_name:factory.machines.generators"), World.Generators.Num(), Time);
+                        break;
+                    }
+                    for (int32 Slot = 0; Slot < World.Generators.Num(); Slot++)
+                    {
+                        Store.Write(Slot, World.Generators[Slot]);
+                        if (FSplunkEventEncoders::WriteGeneratorEvent(Writer, Store, Slot, DeltaTracker, Time, bKeyframe))
+                        {
+                            Commit();
+                        }
+                    }
+                    break;
+                case ECollector::Vehicles:
+                    Result.Items += World.Vehicles.Num();
+                    if (bMetrics)
+                    {
+                        WriteCountMetric(SPLUNK_HEC_KEY("metric_name:factory.vehicles.wheeled"), World.Vehicles.Num(), Time);
+                        break;
+                    }
+                    for (const FSplunkVehicleReading& Vehicle : World.Vehicles)
+                    {
+                        FSplunkEventEncoders::WriteVehicleEvent(Writer, Vehicle, Time);
+                        Commit();
+                    }
+                    break;
+                case ECollector::Trains:
+                    Result.Items += World.Trains.Num();
+                    if (bMetrics)
+                    {
+                        WriteCountMetric(SPLUNK_HEC_KEY("metric_name:factory.vehicles.trains"), World.Trains.Num(), Time);
+                        break;
+                    }
+                    for (const FSplunkTrainReading& Train : World.Trains)
+                    {
+                        FSplunkEventEncoders::WriteTrainEvent(Writer, Train, Time);
+                        Commit();
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        void Commit()
+        {
+            Writer.EndEvent();
+            Pipeline.Submit(Writer.GetSamples(), Result.Mode == EMode::Metrics ? ESplunkLane::Metrics : ESplunkLane::Events, false);
+            Writer.Reset();
+            Result.Events++;
+        }
+
+        // The production metrics pass for one machine list: rows into the store, then totals and groups from its columns
+        void WriteMachineMetrics(const TArray<FSplunkMachineReading>& Machines, bool bExtractors, int64 Time)
+        {
+            Store.BeginPass(Machines.Num());
+            for (int32 Slot = 0; Slot < Machines.Num(); Slot++)
+            {
+                Store.Write(Slot, Machines[Slot]);
+            }
+
+            const FSplunkMachineRollup Rollup = Store.Rollup();
+            ClassGroups.Reset(64);
+            ResourceGroups.Reset(64);
+            Store.RollupGroups(bExtractors ? ResourceGroups : ClassGroups);
+
+            FSplunkEventEncoders::WriteProductionMetrics(Writer, Time,
+                bExtractors ? FSplunkMachineRollup() : Rollup, bExtractors ? Rollup : FSplunkMachineRollup(),
+                ClassGroups, ResourceGroups, [this]() { Commit(); });
+        }
+
+        void WriteCountMetric(FSplunkHECToken Key, int32 Count, int64 Time)
+        {
+            Writer.BeginMetricsEvent(Time);
+            Writer.BeginObject(SPLUNK_HEC_KEY("fields"));
+            Writer.WriteInt(Key, Count);
+            Writer.EndObject();
+            Commit();
+        }
+
+        const FConfig& Config;
+        FSplunkPipeline Pipeline;
+        FSplunkSampleWriter Writer;
+        FSplunkMachineStore Store;
+        FSplunkDeltaTracker Deltas;
+        TSplunkMetricGroups<FSplunkMachineRollup> ClassGroups;
+        TSplunkMetricGroups<FSplunkMachineRollup> ResourceGroups;
+        FWorld World;
+        FResult Result;
+        int64 WireBytes = 0;
+    };
+}
+
+namespace SplunkBenchmark
+{
+    /**
+     * Replays add/remove sequences against a TSplunkActorList and a plain set, checking the
+     * list's index after every step. A slip in the swap-remove bookkeeping doesn't fail at
+     * once; it shows up as an out-of-bounds remove a few dismantles later.
+     */
+    static bool CheckActorList()
+    {
+        static constexpr int32 NumActors = 64;
+        static constexpr int32 NumSteps = 20000;
+
+        TArray<AActor*> Actors;
+        for (int32 i = 0; i < NumActors; i++)
+        {
+            AActor* Actor = NewObject<AActor>(GetTransientPackage(), NAME_None, RF_Transient);
+            Actor->AddToRoot();
+            Actors.Add(Actor);
+        }
+        ON_SCOPE_EXIT
+        {
+            for (AActor* Actor : Actors)
+            {
+                Actor->RemoveFromRoot();
+            }
+        };
+
+        TSplunkActorList<AActor> List;
+        TSet<AActor*> Expected;
+
+        auto Verify = [&List, &Expected](int32 Step)
+        {
+            bool bOk = List.CheckInvariants() && List.Num() == Expected.Num();
+            for (int32 i = 0; bOk && i < List.Num(); i++)
+            {
+                bOk = Expected.Contains(List[i].Get());
+            }
+            if (!bOk)
+            {
+                UE_LOG(LogSatisfactorySplunkMod, Error, TEXT("SplunkBenchmark: Actor list check failed at step %d (%d listed, %d expected)"),
+                    Step, List.Num(), Expected.Num());
+            }
+            return bOk;
+        };
+
+        auto Step = [&List, &Expected](AActor* Actor, bool bAdd)
+        {
+            if (bAdd)
+            {
+                List.Add(Actor);
+                Expected.Add(Actor);
+                return true;
+            }
+            return List.Remove(Actor) == (Expected.Remove(Actor) > 0);
+        };
+
+        // Four actors dismantled out of order, then the one that was swapped the furthest
+        for (int32 i = 0; i < 4; i++)
+        {
+            Step(Actors[i], true);
+        }
+        int32 StepIndex = 0;
+        for (int32 i : { 1, 2, 0, 3 })
+        {
+            if (!Step(Actors[i], false) || !Verify(StepIndex++)) return false;
+        }
+
+        FRandomStream Random(7);
+        for (int32 i = 0; i < NumSteps; i++)
+        {
+            AActor* Actor = Actors[Random.RandHelper(NumActors)];
+            if (!Step(Actor, Random.FRand() < 0.55f) || !Verify(StepIndex++)) return false;
+        }
+        return true;
+    }
+}
+
+USplunkBenchmarkCommandlet::USplunkBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 USplunkBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace SplunkBenchmark;
+
+    FConfig Config;
+    FParse::Value(*Params, TEXT("Manufacturers="), Config.Manufacturers);
+    FParse::Value(*Params, TEXT("Extractors="), Config.Extractors);
+    FParse::Value(*Params, TEXT("Generators="), Config.Generators);
+    FParse::Value(*Params, TEXT("Vehicles="), Config.Vehicles);
+    FParse::Value(*Params, TEXT("Trains="), Config.Trains);
+    FParse::Value(*Params, TEXT("CarsPerTrain="), Config.CarsPerTrain);
+    FParse::Value(*Params, TEXT("Samples="), Config.Samples);
+    FParse::Value(*Params, TEXT("ChangeRatio="), Config.ChangeRatio);
+    FParse::Value(*Params, TEXT("Gzip="), Config.GzipLevel);
+    FParse::Value(*Params, TEXT("Csv="), Config.CsvPath);
+    Config.Samples = FMath::Max(Config.Samples, 1);
+    Config.CarsPerTrain = FMath::Max(Config.CarsPerTrain, 1);
+
+    if (!CheckActorList())
+    {
+        return 1;
+    }
+
+    UE_LOG(LogSatisfactorySplunkMod, Display,
+        TEXT("SplunkBenchmark: %d manufacturers, %d extractors, %d generators, %d vehicles, %d trains x %d cars, %d samples, %.0f%% change, gzip %d"),
+        Config.Manufacturers, Config.Extractors, Config.Generators, Config.Vehicles, Config.Trains, Config.CarsPerTrain,
+        Config.Samples, Config.ChangeRatio * 100.0f, Config.GzipLevel);
+
+    FString Csv = TEXT("collector,mode,items,events,record_us_per_item,encode_us_per_item,compress_us_total,allocs_per_item,payload_bytes,wire_bytes,bytes_per_item\n");
+
+    UE_LOG(LogSatisfactorySplunkMod, Display, TEXT("%-14s %-13s %9s %9s %12s %12s %12s %12s %12s"),
+        TEXT("collector"), TEXT("mode"), TEXT("items"), TEXT("events"), TEXT("record us/i"), TEXT("encode us/i"), TEXT("allocs/i"), TEXT("bytes/i"), TEXT("wire bytes"));
+
+    for (int32 Collector = 0; Collector < (int32)ECollector::Num; Collector++)
+    {
+        for (EMode Mode : { EMode::Events, EMode::Delta, EMode::Metrics })
+        {
+            FRun Run(Config, (ECollector)Collector, Mode);
+            const FResult Result = Run.Execute();
+
+            const double Items = FMath::Max<double>(Result.Items, 1.0);
+            const double RecordUsPerItem = Result.RecordSeconds * 1000000.0 / Items;
+            const double EncodeUsPerItem = Result.EncodeMicros / Items;
+            const double AllocsPerItem = Result.Allocations / Items;
+            const double BytesPerItem = Result.PayloadBytes / Items;
+
+            UE_LOG(LogSatisfactorySplunkMod, Display, TEXT("%-14s %-13s %9lld %9lld %12.3f %12.3f %12.3f %12.1f %12lld"),
+                CollectorName(Result.Collector), ModeName(Result.Mode), Result.Items, Result.Events,
+                RecordUsPerItem, EncodeUsPerItem, AllocsPerItem, BytesPerItem, Result.WireBytes);
+
+            Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%.4f,%.4f,%lld,%.4f,%lld,%lld,%.2f\n"),
+                CollectorName(Result.Collector), ModeName(Result.Mode), Result.Items, Result.Events,
+                RecordUsPerItem, EncodeUsPerItem, Result.CompressMicros, AllocsPerItem, Result.PayloadBytes, Result.WireBytes, BytesPerItem);
+        }
+    }
+
+    if (!Config.CsvPath.IsEmpty())
+    {
+        if (!FFileHelper::SaveStringToFile(Csv, *Config.CsvPath))
+        {
+            UE_LOG(LogSatisfactorySplunkMod, Error, TEXT("SplunkBenchmark: Could not write %s"), *Config.CsvPath);
+            return 1;
+        }
+        UE_LOG(LogSatisfactorySplunkMod, Display, TEXT("SplunkBenchmark: Results written to %s"), *Config.CsvPath);
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include "SplunkBuildableRegistry.h"
+#include "SatisfactorySplunkMod.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+USplunkBuildableRegistry* USplunkBuildableRegistry::Get(const UWorld* World)
+{
+    return World ? World->GetSubsystem<USplunkBuildableRegistry>() : nullptr;
+}
+
+bool USplunkBuildableRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USplunkBuildableRegistry::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+        World->RemoveOnActorDestroyedHandler(ActorDestroyedHandle);
+    }
+
+    Manufacturers.Reset();
+    Extractors.Reset();
+    Generators.Reset();
+    Vehicles.Reset();
+    Trains.Reset();
+    Players.Reset();
+    Buildables.Reset();
+    BuildableChanged.Clear();
+    bBuilt = false;
+
+    Super::Deinitialize();
+}
+
+void USplunkBuildableRegistry::Build()
+{
+    UWorld* World = GetWorld();
+    if (!World || bBuilt) return;
+
+    // One full walk to pick up everything loaded from the save.
+    // From here on the lists are maintained incrementally.
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        RegisterActor(*It);
+    }
+
+    ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(this, &USplunkBuildableRegistry::HandleActorSpawned));
+    ActorDestroyedHandle = World->AddOnActorDestroyedHandler(
+        FOnActorDestroyed::FDelegate::CreateUObject(this, &USplunkBuildableRegistry::HandleActorDestroyed));
+
+    bBuilt = true;
+
+    UE_LOG(LogSatisfactorySplunkMod, Log,
+        TEXT("SplunkBuildableRegistry: Built - Manufacturers: %d  Extractors: %d  Generators: %d  Vehicles: %d  Trains: %d  Players: %d  Buildables: %d"),
+        Manufacturers.Num(), Extractors.Num(), Generators.Num(), Vehicles.Num(), Trains.Num(), Players.Num(), Buildables.Num());
+}
+
+void USplunkBuildableRegistry::HandleActorSpawned(AActor* Actor)
+{
+    RegisterActor(Actor);
+    if (AFGBuildable* Buildable = Cast<AFGBuildable>(Actor))
+    {
+        BuildableChanged.Broadcast(Buildable, true);
+    }
+}
+
+void USplunkBuildableRegistry::HandleActorDestroyed(AActor* Actor)
+{
+    // Broadcast first, while listeners can still read the dismantled building
+    if (AFGBuildable* Buildable = Cast<AFGBuildable>(Actor))
+    {
+        BuildableChanged.Broadcast(Buildable, false);
+    }
+    UnregisterActor(Actor);
+}
+
+void USplunkBuildableRegistry::RegisterActor(AActor* Actor)
+{
+    if (!Actor) return;
+
+    // The layout list overlaps the machine lists, so it is kept outside the chain below
+    if (AFGBuildable* Buildable = Cast<AFGBuildable>(Actor))
+    {
+        Buildables.Add(Buildable);
+    }
+
+    // The tracked types are disjoint, so the first match wins
+    if (AFGBuildableManufacturer* Manufacturer = Cast<AFGBuildableManufacturer>(Actor))
+    {
+        Manufacturers.Add(Manufacturer);
+    }
+    else if (AFGBuildableResourceExtractor* Extractor = Cast<AFGBuildableResourceExtractor>(Actor))
+    {
+        Extractors.Add(Extractor);
+    }
+    else if (AFGBuildablePowerGenerator* Generator = Cast<AFGBuildablePowerGenerator>(Actor))
+    {
+        Generators.Add(Generator);
+    }
+    else if (AFGWheeledVehicle* Vehicle = Cast<AFGWheeledVehicle>(Actor))
+    {
+        Vehicles.Add(Vehicle);
+    }
+    else if (AFGTrain* Train = Cast<AFGTrain>(Actor))
+    {
+        Trains.Add(Train);
+    }
+    else if (AFGCharacterPlayer* Player = Cast<AFGCharacterPlayer>(Actor))
+    {
+        Players.Add(Player);
+    }
+}
+
+void USplunkBuildableRegistry::UnregisterActor(AActor* Actor)
+{
+    if (!Actor) return;
+
+    Buildables.Remove(Actor);
+    if (Manufacturers.Remove(Actor)) return;
+    if (Extractors.Remove(Actor))    return;
+    if (Generators.Remove(Actor))    return;
+    if (Vehicles.Remove(Actor))      return;
+    if (Trains.Remove(Actor))        return;
+    Players.Remove(Actor);
+}
@@ -0,0 +1,115 @@
+#include "SplunkCircuitCache.h"
+#include "SplunkBuildableRegistry.h"
+#include "SplunkNameCache.h"
+#include "FGCircuitSubsystem.h"
+#include "FGPowerInfoComponent.h"
+#include "Buildables/FGBuildableFactory.h"
+
+bool FSplunkCircuitCache::AdvanceRebuild(UWorld* World, const USplunkBuildableRegistry& Registry, FSplunkNameCache& Names, int32& Cursor, double Deadline)
+{
+    AFGCircuitSubsystem* Subsystem = AFGCircuitSubsystem::GetCircuitSubsystem(World);
+    if (!Subsystem) return true;
+
+    if (Cursor == 0)
+    {
+        // Changes from here on land in the next rebuild, not this one
+        PendingEntries.Reset();
+        PendingIndexOf.Reset();
+        bDirty = false;
+        NextRefreshTime = FPlatformTime::Seconds() + RefreshSeconds;
+    }
+
+    // The list is swap-removed on dismantle, so a building dismantled mid-walk may shift another past the cursor;
+    // the count is off by one until the next rebuild
+    const TSplunkActorList<AFGBuildable>& Buildables = Registry.GetBuildables();
+    do
+    {
+        if (Cursor >= Buildables.Num()) break;
+        AddMember(Buildables[Cursor].Get(), *Subsystem, Names);
+        Cursor++;
+    }
+    while (FPlatformTime::Seconds() < Deadline);
+
+    if (Cursor < Buildables.Num()) return false;
+
+    Swap(Entries, PendingEntries);
+    PendingEntries.Reset();
+    PendingIndexOf.Reset();
+    RebuildCount++;
+    return true;
+}
+
+void FSplunkCircuitCache::Read(TArray<FSplunkCircuitReading>& Out)
+{
+    Out.Reset();
+
+    for (const FEntry& Entry : Entries)
+    {
+        UFGPowerCircuit* Circuit = Entry.Circuit.Get();
+        if (!Circuit)
+        {
+            // Merged into another grid or split; the next refresh rebuilds
+            bDirty = true;
+            continue;
+        }
+
+        FPowerCircuitStats Stats;
+        Circuit->GetStats(Stats);
+
+        FSplunkCircuitReading& Reading = Out.AddDefaulted_GetRef();
+        Reading.CircuitId      = Entry.CircuitId;
+        Reading.NameId         = Entry.NameId;
+        Reading.Production     = Stats.PowerProduced;
+        Reading.Consumption    = Stats.PowerConsumed;
+        Reading.Capacity       = Stats.PowerProductionCapacity;
+        Reading.MaxConsumption = Stats.MaximumPowerConsumption;
+        Reading.bFuseTriggered = Circuit->IsFuseTriggered();
+        Reading.bHasBatteries  = Circuit->HasBatteries();
+        if (Reading.bHasBatteries)
+        {
+            Reading.BatteryStored        = Circuit->GetBatterySumPowerStore();
+            Reading.BatteryCapacity      = Circuit->GetBatterySumPowerStoreCapacity();
+            Reading.BatteryInput         = Circuit->GetBatterySumPowerInput();
+            Reading.TimeToBatteriesEmpty = Circuit->GetTimeToBatteriesEmpty();
+            Reading.TimeToBatteriesFull  = Circuit->GetTimeToBatteriesFull();
+        }
+        Reading.Generators = Entry.Generators;
+        Reading.Consumers  = Entry.Consumers;
+    }
+}
+
+void FSplunkCircuitCache::Reset()
+{
+    Entries.Reset();
+    PendingEntries.Reset();
+    PendingIndexOf.Reset();
+    bDirty = true;
+}
+
+void FSplunkCircuitCache::AddMember(const AFGBuildable* Building, AFGCircuitSubsystem& Subsystem, FSplunkNameCache& Names)
+{
+    // Membership comes from the buildings; the circuit objects themselves only know their totals
+    const AFGBuildableFactory* Factory = Cast<AFGBuildableFactory>(Building);
+    const UFGPowerInfoComponent* PowerInfo = Factory ? Factory->GetPowerInfo() : nullptr;
+    const UFGPowerCircuit* Circuit = PowerInfo ? PowerInfo->GetPowerCircuit() : nullptr;
+    if (!Circuit) return;
+
+    const int32 CircuitId = Circuit->GetCircuitID();
+    int32* Index = PendingIndexOf.Find(CircuitId);
+    if (!Index)
+    {
+        UFGPowerCircuit* Resolved = Subsystem.FindPowerCircuit(CircuitId);
+        if (!Resolved) return;
+        Index = &PendingIndexOf.Add(CircuitId, PendingEntries.Add({ Resolved, CircuitId, Names.GetCircuitName(CircuitId), 0, 0 }));
+    }
+
+    FEntry& Entry = PendingEntries[*Index];
+    if (Factory->IsA<AFGBuildablePowerGenerator>())
+    {
+        Entry.Generators++;
+    }
+    else
+    {
+        Entry.Consumers++;
+    }
+}
@@ -0,0 +1,41 @@
+#include "SplunkDeltaTracker.h"
+#include "SplunkMachineStore.h"
+
+bool FSplunkDeltaTracker::Update(const FSplunkMachineStore& Store, int32 Slot, bool bForce)
+{
+    check(Slot >= 0 && Slot < Store.Num());
+
+    if (Slot >= States.Num())
+    {
+        States.AddZeroed(Slot + 1 - States.Num());
+    }
+    FState& State = States[Slot];
+    const FSplunkMachineReading Row = Store.Read(Slot);
+
+    const bool bChanged = bForce || !State.bSent
+        || State.Owner != Row.NameId
+        || State.Key != Row.Key
+        || State.bProducing != Row.bProducing
+        || HasMoved(Row.Power, State.Power)
+        || HasMoved(Row.MaxPower, State.MaxPower)
+        || HasMoved(Row.Efficiency, State.Efficiency)
+        || HasMoved(Row.Rate, State.Rate);
+
+    if (!bChanged)
+    {
+        SuppressedTotal++;
+        return false;
+    }
+
+    // Only updated on send, so slow drift is measured against the last sent value and still triggers eventually
+    State.Owner = Row.NameId;
+    State.Key = Row.Key;
+    State.Power = Row.Power;
+    State.MaxPower = Row.MaxPower;
+    State.Efficiency = Row.Efficiency;
+    State.Rate = Row.Rate;
+    State.bProducing = Row.bProducing;
+    State.bSent = true;
+    SentTotal++;
+    return true;
+}
@@ -0,0 +1,404 @@
+#include "SplunkEventEncoders.h"
+#include "SplunkNameCache.h"
+#include "SplunkDeltaTracker.h"
+
+void FSplunkVehicleReading::Reset()
+{
+    // Keeps the arrays' allocations; readings are reused from one vehicle to the next
+    TArray<FSplunkItemStack> KeptFuel = MoveTemp(FuelItems);
+    TArray<FSplunkItemStack> KeptCargo = MoveTemp(Cargo);
+    *this = FSplunkVehicleReading();
+    FuelItems = MoveTemp(KeptFuel);
+    Cargo = MoveTemp(KeptCargo);
+    FuelItems.Reset();
+    Cargo.Reset();
+}
+
+void FSplunkTrainReading::Reset()
+{
+    TArray<FSplunkTrainCar> KeptCars = MoveTemp(Cars);
+    TArray<FSplunkItemStack> KeptCargo = MoveTemp(Cargo);
+    *this = FSplunkTrainReading();
+    Cars = MoveTemp(KeptCars);
+    Cargo = MoveTemp(KeptCargo);
+    Cars.Reset();
+    Cargo.Reset();
+}
+
+bool FSplunkEventEncoders::WriteManufacturerEvent(FSplunkSampleWriter& Writer, const FSplunkMachineStore& Store, int32 Slot,
+    const FSplunkRecipeNames* Recipe, FSplunkDeltaTracker* Deltas, int64 Time, bool bKeyframe)
+{
+    if (Deltas && !Deltas->Update(Store, Slot, bKeyframe))
+    {
+        return false;
+    }
+    const FSplunkMachineReading Row = Store.Read(Slot);
+
+    Writer.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:production"));
+    Writer.BeginObject(SPLUNK_HEC_KEY("event"));
+
+    // Machine data
+    Writer.WriteString(SPLUNK_HEC_KEY("machine_type"), SPLUNK_HEC_STRING("Manufacturer"));
+    Writer.WriteName(SPLUNK_HEC_KEY("machine_id"), Row.NameId);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("power_consumption"), Row.Power);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("efficiency"), Row.Efficiency);
+    if (Deltas)
+    {
+        Writer.WriteBool(SPLUNK_HEC_KEY("keyframe"), bKeyframe);
+    }
+
+    // Recipe information
+    if (Recipe)
+    {
+        Writer.WriteName(SPLUNK_HEC_KEY("recipe_name"), Recipe->RecipeNameId);
+
+        if (Recipe->Products.Num() > 0)
+        {
+            Writer.WriteName(SPLUNK_HEC_KEY("output_item"), Recipe->Products[0].NameId);
+            Writer.WriteInt(SPLUNK_HEC_KEY("output_rate"), Recipe->Products[0].Amount);
+        }
+
+        if (Recipe->Ingredients.Num() > 0)
+        {
+            Writer.WriteName(SPLUNK_HEC_KEY("input_item"), Recipe->Ingredients[0].NameId);
+            Writer.WriteInt(SPLUNK_HEC_KEY("input_rate"), Recipe->Ingredients[0].Amount);
+        }
+
+        // Handle multi-input recipes
+        if (Recipe->Ingredients.Num() > 1)
+        {
+            Writer.BeginArray(SPLUNK_HEC_KEY("secondary_inputs"));
+            for (int32 i = 1; i < Recipe->Ingredients.Num(); i++)
+            {
+                Writer.BeginObject();
+                Writer.WriteName(SPLUNK_HEC_KEY("item"), Recipe->Ingredients[i].NameId);
+                Writer.WriteInt(SPLUNK_HEC_KEY("rate"), Recipe->Ingredients[i].Amount);
+                Writer.EndObject();
+            }
+            Writer.EndArray();
+        }
+    }
+
+    // Location data
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_x"), Row.Location.X);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_y"), Row.Location.Y);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_z"), Row.Location.Z);
+
+    Writer.EndObject();
+    return true;
+}
+
+bool FSplunkEventEncoders::WriteExtractorEvent(FSplunkSampleWriter& Writer, const FSplunkMachineStore& Store, int32 Slot,
+    FSplunkDeltaTracker* Deltas, int64 Time, bool bKeyframe)
+{
+    if (Deltas && !Deltas->Update(Store, Slot, bKeyframe))
+    {
+        return false;
+    }
+    const FSplunkMachineReading Row = Store.Read(Slot);
+
+    Writer.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:extraction"));
+    Writer.BeginObject(SPLUNK_HEC_KEY("event"));
+
+    Writer.WriteString(SPLUNK_HEC_KEY("machine_type"), SPLUNK_HEC_STRING("Extractor"));
+    Writer.WriteName(SPLUNK_HEC_KEY("machine_id"), Row.NameId);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("power_consumption"), Row.Power);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("efficiency"), Row.Efficiency);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("extraction_rate"), Row.Rate);
+    if (Deltas)
+    {
+        Writer.WriteBool(SPLUNK_HEC_KEY("keyframe"), bKeyframe);
+    }
+
+    // Resource type (the key is the resource class, 0 if the extractor has none)
+    if (Row.Key != 0)
+    {
+        Writer.WriteName(SPLUNK_HEC_KEY("resource_type"), Row.GroupId);
+    }
+
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_x"), Row.Location.X);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_y"), Row.Location.Y);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_z"), Row.Location.Z);
+
+    Writer.EndObject();
+    return true;
+}
+
+bool FSplunkEventEncoders::WriteGeneratorEvent(FSplunkSampleWriter& Writer, const FSplunkMachineStore& Store, int32 Slot,
+    FSplunkDeltaTracker* Deltas, int64 Time, bool bKeyframe)
+{
+    // Fuel levels drain continuously, so they ride along with an event but never trigger one
+    if (Deltas && !Deltas->Update(Store, Slot, bKeyframe))
+    {
+        return false;
+    }
+    const FSplunkMachineReading Row = Store.Read(Slot);
+
+    Writer.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:power:generator"));
+    Writer.BeginObject(SPLUNK_HEC_KEY("event"));
+
+    Writer.WriteName(SPLUNK_HEC_KEY("generator_type"), Row.GroupId);
+    Writer.WriteName(SPLUNK_HEC_KEY("generator_id"), Row.NameId);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("power_production"), Row.Power);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("max_power_production"), Row.MaxPower);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("efficiency"), Row.Efficiency);
+    Writer.WriteBool(SPLUNK_HEC_KEY("is_producing"), Row.bProducing);
+    if (Deltas)
+    {
+        Writer.WriteBool(SPLUNK_HEC_KEY("keyframe"), bKeyframe);
+    }
+
+    // Location
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_x"), Row.Location.X);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_y"), Row.Location.Y);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_z"), Row.Location.Z);
+
+    // Fuel data for fuel-powered generators
+    if (Row.FuelStacks != INDEX_NONE)
+    {
+        Writer.WriteNumber(SPLUNK_HEC_KEY("fuel_energy_available"), Row.FuelEnergy);
+        Writer.WriteInt(SPLUNK_HEC_KEY("fuel_stacks"), Row.FuelStacks);
+    }
+
+    Writer.EndObject();
+    return true;
+}
+
+void FSplunkEventEncoders::WriteVehicleEvent(FSplunkSampleWriter& Writer, const FSplunkVehicleReading& Vehicle, int64 Time)
+{
+    if (Vehicle.bAutomated)
+    {
+        Writer.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:vehicle:automated"));
+    }
+    else
+    {
+        Writer.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:vehicle:personal"));
+    }
+    Writer.BeginObject(SPLUNK_HEC_KEY("event"));
+
+    Writer.WriteString(SPLUNK_HEC_KEY("vehicle_type"), Vehicle.VehicleType);
+    Writer.WriteName(SPLUNK_HEC_KEY("vehicle_id"), Vehicle.NameId);
+    Writer.WriteBool(SPLUNK_HEC_KEY("is_player_driven"), Vehicle.bPlayerDriven);
+    Writer.WriteBool(SPLUNK_HEC_KEY("is_automated"), Vehicle.bAutomated);
+
+    // Position and movement
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_x"), Vehicle.Location.X);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_y"), Vehicle.Location.Y);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("location_z"), Vehicle.Location.Z);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("speed"), Vehicle.Speed);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("heading"), Vehicle.Rotation.Yaw);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("pitch"), Vehicle.Rotation.Pitch);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("roll"), Vehicle.Rotation.Roll);
+
+    // Player information if player-driven
+    if (Vehicle.DriverNameId != INDEX_NONE)
+    {
+        Writer.WriteName(SPLUNK_HEC_KEY("driver_name"), Vehicle.DriverNameId);
+        if (Vehicle.PlayerId != INDEX_NONE)
+        {
+            Writer.WriteName(SPLUNK_HEC_KEY("player_id"), Vehicle.PlayerId);
+        }
+    }
+
+    // Fuel system
+    if (Vehicle.bHasFuelInventory)
+    {
+        float TotalFuelEnergy = 0.0f;
+        const float MaxFuelEnergy = Vehicle.FuelSlots * 100.0f; // Approximate max energy per slot
+
+        Writer.BeginArray(SPLUNK_HEC_KEY("fuel_items"));
+        for (const FSplunkItemStack& Stack : Vehicle.FuelItems)
+        {
+            Writer.BeginObject();
+            Writer.WriteName(SPLUNK_HEC_KEY("fuel_type"), Stack.NameId);
+            Writer.WriteInt(SPLUNK_HEC_KEY("quantity"), Stack.Quantity);
+            Writer.WriteNumber(SPLUNK_HEC_KEY("energy_value"), Stack.Value);
+            Writer.EndObject();
+            TotalFuelEnergy += Stack.Value * Stack.Quantity;
+        }
+        Writer.EndArray();
+
+        Writer.WriteNumber(SPLUNK_HEC_KEY("fuel_energy_current"), TotalFuelEnergy);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("fuel_energy_max"), MaxFuelEnergy);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("fuel_percentage"), MaxFuelEnergy > 0 ? TotalFuelEnergy / MaxFuelEnergy : 0.0f);
+    }
+
+    // Inventory/Storage
+    if (Vehicle.bHasStorage)
+    {
+        float TotalWeight = 0.0f;
+
+        Writer.BeginArray(SPLUNK_HEC_KEY("cargo"));
+        for (const FSplunkItemStack& Stack : Vehicle.Cargo)
+        {
+            Writer.BeginObject();
+            Writer.WriteName(SPLUNK_HEC_KEY("item_name"), Stack.NameId);
+            Writer.WriteInt(SPLUNK_HEC_KEY("quantity"), Stack.Quantity);
+            Writer.WriteNumber(SPLUNK_HEC_KEY("weight"), Stack.Value);
+            Writer.EndObject();
+            TotalWeight += Stack.Value;
+        }
+        Writer.EndArray();
+
+        const int32 SlotsUsed = Vehicle.Cargo.Num();
+        Writer.WriteInt(SPLUNK_HEC_KEY("cargo_slots_used"), SlotsUsed);
+        Writer.WriteInt(SPLUNK_HEC_KEY("cargo_slots_total"), Vehicle.CargoSlots);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("cargo_utilization"), Vehicle.CargoSlots > 0 ? (float)SlotsUsed / Vehicle.CargoSlots : 0.0f);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("cargo_weight"), TotalWeight);
+    }
+
+    // Vehicle-specific data
+    if (Vehicle.bElectric)
+    {
+        Writer.WriteString(SPLUNK_HEC_KEY("power_type"), SPLUNK_HEC_STRING("Electric"));
+    }
+    else
+    {
+        Writer.WriteString(SPLUNK_HEC_KEY("power_type"), SPLUNK_HEC_STRING("Fuel"));
+    }
+
+    Writer.WriteNumber(SPLUNK_HEC_KEY("max_speed"), Vehicle.MaxSpeed);
+
+    // Autopilot data for automated vehicles
+    if (Vehicle.TargetStationId != INDEX_NONE)
+    {
+        Writer.WriteName(SPLUNK_HEC_KEY("target_station"), Vehicle.TargetStationId);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("distance_to_target"), Vehicle.DistanceToTarget);
+    }
+
+    Writer.EndObject();
+}
+
+void FSplunkEventEncoders::WriteTrainEvent(FSplunkSampleWriter& Writer, const FSplunkTrainReading& Train, int64 Time)
+{
+    Writer.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:vehicle:train"));
+    Writer.BeginObject(SPLUNK_HEC_KEY("event"));
+
+    Writer.WriteString(SPLUNK_HEC_KEY("vehicle_type"), SPLUNK_HEC_STRING("Train"));
+    Writer.WriteName(SPLUNK_HEC_KEY("train_id"), Train.NameId);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("speed"), Train.Speed);
+    Writer.WriteBool(SPLUNK_HEC_KEY("is_player_driven"), Train.bPlayerDriven);
+    Writer.WriteInt(SPLUNK_HEC_KEY("car_count"), Train.ConsistNum);
+
+    float TotalPowerConsumption = 0.0f;
+
+    Writer.BeginArray(SPLUNK_HEC_KEY("cars"));
+    for (const FSplunkTrainCar& Car : Train.Cars)
+    {
+        Writer.BeginObject();
+        Writer.WriteInt(SPLUNK_HEC_KEY("car_index"), Car.Index);
+        Writer.WriteName(SPLUNK_HEC_KEY("car_id"), Car.NameId);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("location_x"), Car.Location.X);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("location_y"), Car.Location.Y);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("location_z"), Car.Location.Z);
+
+        if (Car.bLocomotive)
+        {
+            Writer.WriteString(SPLUNK_HEC_KEY("car_type"), SPLUNK_HEC_STRING("Locomotive"));
+            Writer.WriteNumber(SPLUNK_HEC_KEY("power_consumption"), Car.PowerConsumption);
+            TotalPowerConsumption += Car.PowerConsumption;
+
+            if (Car.FuelPercentage >= 0.0f)
+            {
+                Writer.WriteNumber(SPLUNK_HEC_KEY("fuel_percentage"), Car.FuelPercentage);
+            }
+        }
+        else if (Car.bFreight)
+        {
+            Writer.WriteString(SPLUNK_HEC_KEY("car_type"), SPLUNK_HEC_STRING("Freight"));
+
+            if (Car.CargoSlots >= 0)
+            {
+                Writer.BeginArray(SPLUNK_HEC_KEY("cargo"));
+                for (int32 i = Car.CargoBegin; i < Car.CargoBegin + Car.CargoNum; i++)
+                {
+                    Writer.BeginObject();
+                    Writer.WriteName(SPLUNK_HEC_KEY("item_name"), Train.Cargo[i].NameId);
+                    Writer.WriteInt(SPLUNK_HEC_KEY("quantity"), Train.Cargo[i].Quantity);
+                    Writer.EndObject();
+                }
+                Writer.EndArray();
+
+                Writer.WriteNumber(SPLUNK_HEC_KEY("cargo_utilization"), Car.CargoSlots > 0 ? (float)Car.CargoNum / Car.CargoSlots : 0.0f);
+            }
+        }
+
+        Writer.EndObject();
+    }
+    Writer.EndArray();
+
+    Writer.WriteNumber(SPLUNK_HEC_KEY("total_power_consumption"), TotalPowerConsumption);
+
+    // Timetable information
+    if (Train.bHasTimeTable)
+    {
+        Writer.WriteInt(SPLUNK_HEC_KEY("timetable_stations"), Train.TimeTableStations);
+        Writer.WriteInt(SPLUNK_HEC_KEY("current_stop_index"), Train.CurrentStop);
+        if (!Train.CurrentStation.IsEmpty())
+        {
+            Writer.WriteString(SPLUNK_HEC_KEY("current_station"), Train.CurrentStation);
+        }
+    }
+
+    Writer.EndObject();
+}
+
+void FSplunkEventEncoders::WriteProductionMetrics(FSplunkSampleWriter& Writer, int64 Time,
+    const FSplunkMachineRollup& Manufacturers, const FSplunkMachineRollup& Extractors,
+    const TSplunkMetricGroups<FSplunkMachineRollup>& Classes, const TSplunkMetricGroups<FSplunkMachineRollup>& Resources,
+    TFunctionRef<void()> Commit)
+{
+    Writer.BeginMetricsEvent(Time);
+    Writer.BeginObject(SPLUNK_HEC_KEY("fields"));
+    FSplunkMachineRollup All = Manufacturers;
+    All += Extractors;
+
+    Writer.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.machines.manufacturers"), Manufacturers.Machines);
+    Writer.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.machines.extractors"),   Extractors.Machines);
+    Writer.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.machines.producing"),    All.Producing);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.efficiency.average"), All.Producing > 0 ? All.TotalEfficiency / All.Producing : 0.0f);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.efficiency.p10"),     All.GetEfficiencyPercentile(0.1f));
+    Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.efficiency.p50"),     All.GetEfficiencyPercentile(0.5f));
+    Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.machines.power.consumption"), All.PowerConsumption);
+    Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.extraction.rate"),    Extractors.ExtractionRate);
+    Writer.EndObject();
+    Commit();
+
+    Classes.ForEach([&Writer, &Commit, Time](int32 ClassName, const FSplunkMachineRollup& Class)
+    {
+        Writer.BeginMetricsEvent(Time);
+        Writer.BeginObject(SPLUNK_HEC_KEY("fields"));
+        WriteDimension(Writer, SPLUNK_HEC_KEY("machine_class"), ClassName);
+        Writer.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.class.machines"),             Class.Machines);
+        Writer.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.class.producing"),            Class.Producing);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.class.efficiency.average"), Class.Producing > 0 ? Class.TotalEfficiency / Class.Producing : 0.0f);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.class.power.consumption"),  Class.PowerConsumption);
+        Writer.EndObject();
+        Commit();
+    });
+
+    Resources.ForEach([&Writer, &Commit, Time](int32 ResourceName, const FSplunkMachineRollup& Resource)
+    {
+        Writer.BeginMetricsEvent(Time);
+        Writer.BeginObject(SPLUNK_HEC_KEY("fields"));
+        WriteDimension(Writer, SPLUNK_HEC_KEY("resource_type"), ResourceName);
+        Writer.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.resource.extractors"),           Resource.Machines);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.resource.extraction_rate"),   Resource.ExtractionRate);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.resource.efficiency.average"), Resource.Producing > 0 ? Resource.TotalEfficiency / Resource.Producing : 0.0f);
+        Writer.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.resource.power.consumption"),  Resource.PowerConsumption);
+        Writer.EndObject();
+        Commit();
+    });
+}
+
+void FSplunkEventEncoders::WriteDimension(FSplunkSampleWriter& Writer, FSplunkHECToken Key, int32 NameId)
+{
+    if (NameId == TSplunkMetricGroups<FSplunkMachineRollup>::OtherKey)
+    {
+        Writer.WriteString(Key, SPLUNK_HEC_STRING("_other"));
+    }
+    else
+    {
+        Writer.WriteName(Key, NameId);
+    }
+}
@@ -0,0 +1,115 @@
+#include "SplunkEventRing.h"
+
+FSplunkEventRing::FSplunkEventRing(int32 InCapacityBytes)
+{
+    SetCapacity(InCapacityBytes);
+}
+
+void FSplunkEventRing::SetCapacity(int32 InCapacityBytes)
+{
+    Storage.Empty();
+    Storage.SetNumUninitialized(FMath::Max(InCapacityBytes, 0));
+    Head = 0;
+    UsedBytes = 0;
+    NumEvents = 0;
+}
+
+bool FSplunkEventRing::Push(const uint8* Data, int32 Len, bool bEvictOldest)
+{
+    const int32 RecordBytes = HeaderBytes + Len;
+    if (RecordBytes > Storage.Num())
+    {
+        DroppedEvents++;
+        DroppedBytes += Len;
+        return false;
+    }
+
+    if (UsedBytes + RecordBytes > Storage.Num())
+    {
+        if (!bEvictOldest)
+        {
+            DroppedEvents++;
+            DroppedBytes += Len;
+            return false;
+        }
+        while (UsedBytes + RecordBytes > Storage.Num())
+        {
+            DropOldest();
+        }
+    }
+
+    const int32 Tail = Wrap(Head + UsedBytes);
+    const uint32 Length = (uint32)Len;
+    Write(Tail, reinterpret_cast<const uint8*>(&Length), HeaderBytes);
+    Write(Wrap(Tail + HeaderBytes), Data, Len);
+
+    UsedBytes += RecordBytes;
+    NumEvents++;
+    return true;
+}
+
+int32 FSplunkEventRing::PopBatch(TArray<uint8>& Out, int32 MaxBytes, int32 MaxEvents)
+{
+    int32 Moved = 0;
+    int32 MovedBytes = 0;
+
+    while (NumEvents > 0 && Moved < MaxEvents)
+    {
+        uint32 Length = 0;
+        Read(Head, reinterpret_cast<uint8*>(&Length), HeaderBytes);
+        if (Moved > 0 && MovedBytes + (int32)Length > MaxBytes)
+        {
+            break;
+        }
+
+        const int32 Offset = Out.AddUninitialized(Length);
+        Read(Wrap(Head + HeaderBytes), Out.GetData() + Offset, Length);
+
+        Head = Wrap(Head + HeaderBytes + Length);
+        UsedBytes -= HeaderBytes + Length;
+        NumEvents--;
+        Moved++;
+        MovedBytes += Length;
+    }
+
+    if (NumEvents == 0)
+    {
+        Head = 0;
+    }
+    return Moved;
+}
+
+void FSplunkEventRing::DropOldest()
+{
+    check(NumEvents > 0);
+
+    uint32 Length = 0;
+    Read(Head, reinterpret_cast<uint8*>(&Length), HeaderBytes);
+
+    Head = Wrap(Head + HeaderBytes + Length);
+    UsedBytes -= HeaderBytes + Length;
+    NumEvents--;
+
+    DroppedEvents++;
+    DroppedBytes += Length;
+}
+
+void FSplunkEventRing::Write(int32 Offset, const uint8* Data, int32 Len)
+{
+    const int32 FirstPart = FMath::Min(Len, Storage.Num() - Offset);
+    FMemory::Memcpy(Storage.GetData() + Offset, Data, FirstPart);
+    if (FirstPart < Len)
+    {
+        FMemory::Memcpy(Storage.GetData(), Data + FirstPart, Len - FirstPart);
+    }
+}
+
+void FSplunkEventRing::Read(int32 Offset, uint8* Data, int32 Len) const
+{
+    const int32 FirstPart = FMath::Min(Len, Storage.Num() - Offset);
+    FMemory::Memcpy(Data, Storage.GetData() + Offset, FirstPart);
+    if (FirstPart < Len)
+    {
+        FMemory::Memcpy(Data + FirstPart, Storage.GetData(), Len - FirstPart);
+    }
+}
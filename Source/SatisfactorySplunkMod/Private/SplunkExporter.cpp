@@ -1,12 +1,303 @@
 #include "SplunkExporter.h"
 #include "SatisfactorySplunkMod.h"
+#include "SplunkBuildableRegistry.h"
+#include "SplunkHttpSender.h"
+#include "SplunkEventEncoders.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
-#include "EngineIterator.h"
+#include "EngineUtils.h"
+
+namespace SplunkExporter
+{
+    // DegradeToMetrics hysteresis
+    static constexpr float DegradeFillRatio = 0.9f;
+    static constexpr float RecoverFillRatio = 0.25f;
+
+    /**
+     * Writes events for List[Cursor...] until the list is done or Deadline passes, calling
+     * Write(Actor, Slot) with each actor's registry slot.
+     * At least one actor is processed per call so a sweep always makes progress.
+     * @return true once the cursor has reached the end of the list
+     */
+    template<typename ActorType, typename WriteFunc>
+    static bool AdvanceCursor(const TSplunkActorList<ActorType>& List, int32& Cursor, double Deadline, WriteFunc&& Write)
+    {
+        do
+        {
+            if (Cursor >= List.Num()) return true;
+            if (ActorType* Actor = List[Cursor].Get())
+            {
+                Write(Actor, List.GetSlot(Cursor));
+            }
+            Cursor++;
+        }
+        while (FPlatformTime::Seconds() < Deadline);
+
+        return Cursor >= List.Num();
+    }
+
+    static float GetFuelEnergyValue(UFGItemDescriptor* ItemDesc)
+    {
+        float EnergyValue = 100.0f; // Default energy value
+        if (UFGItemDescriptorNuclearFuel* NuclearFuel = Cast<UFGItemDescriptorNuclearFuel>(ItemDesc))
+        {
+            EnergyValue = NuclearFuel->GetEnergyValue();
+        }
+        else if (UFGItemDescriptorBiomass* BiomassFuel = Cast<UFGItemDescriptorBiomass>(ItemDesc))
+        {
+            EnergyValue = BiomassFuel->GetEnergyValue();
+        }
+        return EnergyValue;
+    }
+
+    // Machine readings as stored in FSplunkMachineStore; shared by the metrics pass and the events sweeps
+    static void ReadMachine(AFGBuildableManufacturer* Manufacturer, FSplunkNameCache& Names, FSplunkMachineReading& Out)
+    {
+        Out = FSplunkMachineReading();
+        Out.NameId = Names.GetActorName(Manufacturer);
+        Out.GroupId = Names.GetClassName(Manufacturer->GetClass());
+        Out.Key = (UPTRINT)Manufacturer->GetCurrentRecipe().Get();
+        Out.Power = Manufacturer->GetPowerConsumption();
+        Out.Efficiency = Manufacturer->GetProductionEfficiency();
+        Out.Location = Manufacturer->GetActorLocation();
+    }
+
+    static void ReadMachine(AFGBuildableResourceExtractor* Extractor, FSplunkNameCache& Names, FSplunkMachineReading& Out)
+    {
+        Out = FSplunkMachineReading();
+        TSubclassOf<UFGResourceDescriptor> ResourceClass = Extractor->GetResourceClass();
+        Out.NameId = Names.GetActorName(Extractor);
+        Out.GroupId = Names.GetItemName(ResourceClass);
+        Out.Key = (UPTRINT)ResourceClass.Get();
+        Out.Power = Extractor->GetPowerConsumption();
+        Out.Efficiency = Extractor->GetProductionEfficiency();
+        Out.Rate = Extractor->GetExtractionRate();
+        Out.Location = Extractor->GetActorLocation();
+    }
+
+    static void ReadMachine(AFGBuildablePowerGenerator* Generator, FSplunkNameCache& Names, FSplunkMachineReading& Out)
+    {
+        Out = FSplunkMachineReading();
+        Out.NameId = Names.GetActorName(Generator);
+        Out.GroupId = Names.GetClassName(Generator->GetClass());
+        Out.Power = Generator->GetPowerProduction();
+        Out.MaxPower = Generator->GetMaxPowerProduction();
+        Out.Efficiency = Generator->GetProductionEfficiency();
+        Out.bProducing = Generator->IsProducing();
+        Out.Location = Generator->GetActorLocation();
+
+        // Fuel data for fuel-powered generators
+        AFGBuildablePowerGeneratorFuel* FuelGenerator = Cast<AFGBuildablePowerGeneratorFuel>(Generator);
+        UFGInventoryComponent* FuelInventory = FuelGenerator ? FuelGenerator->GetFuelInventory() : nullptr;
+        if (!FuelInventory) return;
+
+        Out.FuelStacks = 0;
+        for (int32 i = 0; i < FuelInventory->GetSizeLinear(); i++)
+        {
+            FInventoryStack Stack;
+            if (FuelInventory->GetStackFromIndex(i, Stack) && !Stack.Item.ItemClass.IsNull())
+            {
+                Out.FuelStacks++;
+                UFGItemDescriptor* ItemDesc = Stack.Item.ItemClass->GetDefaultObject<UFGItemDescriptor>();
+                Out.FuelEnergy += GetFuelEnergyValue(ItemDesc) * Stack.NumItems;
+            }
+        }
+    }
+
+    static const TCHAR* GetVehicleTypeFromClass(const FString& ClassName)
+    {
+        if (ClassName.Contains(TEXT("Tractor")))
+        {
+            return TEXT("Tractor");
+        }
+        else if (ClassName.Contains(TEXT("Explorer")))
+        {
+            return TEXT("Explorer");
+        }
+        else if (ClassName.Contains(TEXT("CyberWagon")))
+        {
+            return TEXT("CyberWagon");
+        }
+        else if (ClassName.Contains(TEXT("Cart")))
+        {
+            return TEXT("FactoryCart");
+        }
+        else if (ClassName.Contains(TEXT("Truck")))
+        {
+            return TEXT("Truck");
+        }
+
+        return TEXT("Unknown");
+    }
+
+    static void ReadVehicle(AFGWheeledVehicle* Vehicle, FSplunkNameCache& Names, FSplunkVehicleReading& Out)
+    {
+        Out.Reset();
+        Out.NameId = Names.GetActorName(Vehicle);
+        Out.VehicleType = GetVehicleTypeFromClass(Vehicle->GetClass()->GetName());
+        Out.bElectric = FCString::Strcmp(Out.VehicleType, TEXT("CyberWagon")) == 0;
+        Out.bPlayerDriven = Vehicle->IsPlayerDriven();
+        Out.bAutomated = Vehicle->IsAutoPilotEnabled();
+        Out.Location = Vehicle->GetActorLocation();
+        Out.Rotation = Vehicle->GetActorRotation();
+        Out.Speed = Vehicle->GetVelocity().Size();
+        Out.MaxSpeed = Vehicle->GetMaxSpeed();
+
+        // Player information if player-driven
+        if (Out.bPlayerDriven)
+        {
+            if (APawn* Driver = Vehicle->GetInstigator())
+            {
+                Out.DriverNameId = Names.GetActorName(Driver);
+                if (APlayerController* PC = Cast<APlayerController>(Driver->GetController()))
+                {
+                    Out.PlayerId = Names.GetActorName(PC);
+                }
+            }
+        }
+
+        // Fuel system
+        if (UFGInventoryComponent* FuelInventory = Vehicle->GetFuelInventory())
+        {
+            Out.bHasFuelInventory = true;
+            Out.FuelSlots = FuelInventory->GetSizeLinear();
+            for (int32 i = 0; i < Out.FuelSlots; i++)
+            {
+                FInventoryStack Stack;
+                if (FuelInventory->GetStackFromIndex(i, Stack) && !Stack.Item.ItemClass.IsNull())
+                {
+                    UFGItemDescriptor* ItemDesc = Stack.Item.ItemClass->GetDefaultObject<UFGItemDescriptor>();
+                    Out.FuelItems.Add({ Names.GetItemName(Stack.Item.ItemClass.Get()), Stack.NumItems, GetFuelEnergyValue(ItemDesc) });
+                }
+            }
+        }
+
+        // Inventory/Storage
+        if (UFGInventoryComponent* Inventory = Vehicle->GetStorageInventory())
+        {
+            Out.bHasStorage = true;
+            Out.CargoSlots = Inventory->GetSizeLinear();
+            for (int32 i = 0; i < Out.CargoSlots; i++)
+            {
+                FInventoryStack Stack;
+                if (Inventory->GetStackFromIndex(i, Stack) && !Stack.Item.ItemClass.IsNull())
+                {
+                    UFGItemDescriptor* ItemDesc = Stack.Item.ItemClass->GetDefaultObject<UFGItemDescriptor>();
+                    Out.Cargo.Add({ Names.GetItemName(Stack.Item.ItemClass.Get()), Stack.NumItems, ItemDesc->GetWeight() * Stack.NumItems });
+                }
+            }
+        }
+
+        // Autopilot data for automated vehicles
+        if (Out.bAutomated)
+        {
+            if (AFGBuildableDockingStation* TargetStation = Vehicle->GetTargetNodeLinkedDockingStation())
+            {
+                Out.TargetStationId = Names.GetActorName(TargetStation);
+                Out.DistanceToTarget = FVector::Dist(Out.Location, TargetStation->GetActorLocation());
+            }
+        }
+    }
+
+    static void ReadTrain(AFGTrain* Train, FSplunkNameCache& Names, FSplunkTrainReading& Out)
+    {
+        Out.Reset();
+        Out.NameId = Names.GetActorName(Train);
+        Out.Speed = Train->GetVelocity().Size();
+        Out.bPlayerDriven = Train->IsPlayerDriven();
+
+        // Get all rolling stock
+        TArray<AFGRailroadVehicle*> RollingStock = Train->GetConsist();
+        Out.ConsistNum = RollingStock.Num();
+        for (int32 i = 0; i < RollingStock.Num(); i++)
+        {
+            AFGRailroadVehicle* Vehicle = RollingStock[i];
+            if (!Vehicle) continue;
+
+            FSplunkTrainCar& Car = Out.Cars.AddDefaulted_GetRef();
+            Car.Index = i;
+            Car.NameId = Names.GetActorName(Vehicle);
+            Car.Location = Vehicle->GetActorLocation();
+
+            if (AFGLocomotive* Locomotive = Cast<AFGLocomotive>(Vehicle))
+            {
+                Car.bLocomotive = true;
+                Car.PowerConsumption = Locomotive->GetPowerConsumption();
+
+                // Fuel status
+                if (UFGInventoryComponent* FuelInventory = Locomotive->GetFuelInventory())
+                {
+                    int32 FuelStacks = 0;
+                    const int32 MaxFuelStacks = FuelInventory->GetSizeLinear();
+                    for (int32 j = 0; j < MaxFuelStacks; j++)
+                    {
+                        FInventoryStack Stack;
+                        if (FuelInventory->GetStackFromIndex(j, Stack) && !Stack.Item.ItemClass.IsNull())
+                        {
+                            FuelStacks++;
+                        }
+                    }
+                    Car.FuelPercentage = MaxFuelStacks > 0 ? (float)FuelStacks / MaxFuelStacks : 0.0f;
+                }
+            }
+            else if (AFGFreightWagon* FreightCar = Cast<AFGFreightWagon>(Vehicle))
+            {
+                Car.bFreight = true;
+                if (UFGInventoryComponent* CargoInventory = FreightCar->GetStorageInventory())
+                {
+                    Car.CargoSlots = CargoInventory->GetSizeLinear();
+                    Car.CargoBegin = Out.Cargo.Num();
+                    for (int32 j = 0; j < Car.CargoSlots; j++)
+                    {
+                        FInventoryStack Stack;
+                        if (CargoInventory->GetStackFromIndex(j, Stack) && !Stack.Item.ItemClass.IsNull())
+                        {
+                            Out.Cargo.Add({ Names.GetItemName(Stack.Item.ItemClass.Get()), Stack.NumItems, 0.0f });
+                        }
+                    }
+                    Car.CargoNum = Out.Cargo.Num() - Car.CargoBegin;
+                }
+            }
+        }
+
+        // Timetable information
+        if (AFGRailroadTimeTable* TimeTable = Train->GetTimeTable())
+        {
+            TArray<AFGTrainStationIdentifier*> Stations = TimeTable->GetStations();
+            Out.bHasTimeTable = true;
+            Out.TimeTableStations = Stations.Num();
+            Out.CurrentStop = TimeTable->GetCurrentStop();
+            if (Stations.IsValidIndex(Out.CurrentStop) && Stations[Out.CurrentStop])
+            {
+                Out.CurrentStation = Stations[Out.CurrentStop]->GetStationName().ToString();
+            }
+        }
+    }
+
+    /** Reads every listed machine into Store for a metrics pass. */
+    template<typename ActorType>
+    static void ReadMachines(const TSplunkActorList<ActorType>& List, FSplunkNameCache& Names, FSplunkMachineStore& Store)
+    {
+        Store.BeginPass(List.GetNumSlots());
+        FSplunkMachineReading Reading;
+        for (int32 i = 0; i < List.Num(); i++)
+        {
+            if (ActorType* Actor = List[i].Get())
+            {
+                ReadMachine(Actor, Names, Reading);
+                Store.Write(List.GetSlot(i), Reading);
+            }
+        }
+    }
+}
 
 ASplunkExporter::ASplunkExporter()
 {
-    PrimaryActorTick.bCanEverTick = false;
+    // Ticks only while an events-mode sweep is in progress
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
     bReplicates = false;
 
     EventsInBuffer = 0;
@@ -28,23 +319,54 @@ void ASplunkExporter::LoadSettingsFromConfig()
     HECToken              = Settings->HECToken;
     bUseMetricsMode       = Settings->bUseMetricsMode;
     PowerInterval         = Settings->PowerInterval;
+    PowerAlertInterval    = Settings->PowerAlertInterval;
     ProductionInterval    = Settings->ProductionInterval;
     VehicleInterval       = Settings->VehicleInterval;
     PlayerInterval        = Settings->PlayerInterval;
+    LayoutInterval        = Settings->LayoutInterval;
     BufferFlushInterval   = Settings->BufferFlushInterval;
     BatchSize             = Settings->BatchSize;
+    GzipCompressionLevel  = Settings->GzipCompressionLevel;
+    GzipMinPayloadBytes   = Settings->GzipMinPayloadBytes;
+    bEnableDiskSpool      = Settings->bEnableDiskSpool;
+    SpoolMaxDiskMB        = Settings->SpoolMaxDiskMB;
+    SpoolRetryMinSeconds  = Settings->SpoolRetryMinSeconds;
+    SpoolRetryMaxSeconds  = Settings->SpoolRetryMaxSeconds;
+    bUseIndexerAck        = Settings->bUseIndexerAck;
+    AckPollInterval       = Settings->AckPollInterval;
+    AckTimeoutSeconds     = Settings->AckTimeoutSeconds;
+    AckMaxPendingMB       = Settings->AckMaxPendingMB;
+    bRunLocalSink         = Settings->bRunLocalSink;
+    LocalSinkPort         = Settings->LocalSinkPort;
+    LocalSinkLatencyMs    = Settings->LocalSinkLatencyMs;
+    LocalSinkErrorRate    = Settings->LocalSinkErrorRate;
+    LocalSinkDropRate     = Settings->LocalSinkDropRate;
+    MaxBufferMB           = Settings->MaxBufferMB;
+    MaxConcurrentRequests = Settings->MaxConcurrentRequests;
+    BufferOverflowPolicy  = Settings->BufferOverflowPolicy;
+    PowerLaneFlushInterval = Settings->PowerLaneFlushInterval;
+    BulkLaneFlushInterval  = Settings->BulkLaneFlushInterval;
+    bAdaptiveFlush         = Settings->bAdaptiveFlush;
+    CollectorFrameBudgetMs = Settings->CollectorFrameBudgetMs;
+    bDeltaMode            = Settings->bDeltaMode;
+    DeltaEpsilon          = Settings->DeltaEpsilon;
+    DeltaKeyframeInterval = Settings->DeltaKeyframeInterval;
+    bDimensionedMetrics   = Settings->bDimensionedMetrics;
+    MaxSeriesPerDimension = Settings->MaxSeriesPerDimension;
     bCollectPowerData     = Settings->bCollectPowerData;
     bCollectProductionData = Settings->bCollectProductionData;
     bCollectVehicleData   = Settings->bCollectVehicleData;
     bCollectPlayerData    = Settings->bCollectPlayerData;
     bCollectLayoutData    = Settings->bCollectLayoutData;
+    LayoutPageSize        = Settings->LayoutPageSize;
+    bLayoutChangeFeed     = Settings->bLayoutChangeFeed;
 
     UE_LOG(LogSatisfactorySplunkMod, Log,
         TEXT("SplunkExporter: Config loaded - Mode: %s | Power: %.1fs  Production: %.1fs  Vehicles: %.1fs  Players: %.1fs  Flush: %.1fs"),
         bUseMetricsMode ? TEXT("Metrics") : TEXT("Events"),
         PowerInterval, ProductionInterval, VehicleInterval, PlayerInterval, BufferFlushInterval);
 
-    if (!Settings->IsConfigured())
+    if (!Settings->IsConfigured() && !bRunLocalSink)
     {
         UE_LOG(LogSatisfactorySplunkMod, Warning,
             TEXT("SplunkExporter: HEC token and/or Splunk URL are still placeholders. ")
@@ -57,21 +379,169 @@ void ASplunkExporter::BeginPlay()
     Super::BeginPlay();
     UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkExporter: Starting up"));
     LoadSettingsFromConfig();
+    for (FSplunkDeltaTracker& Tracker : MachineDeltas)
+    {
+        Tracker.SetEpsilon(DeltaEpsilon);
+    }
+
+    // The local sink replaces Splunk for this session; a real configured token is the one it expects
+    if (bRunLocalSink)
+    {
+        if (HECToken.IsEmpty() || HECToken == TEXT("your-hec-token-here"))
+        {
+            HECToken = TEXT("local-sink");
+        }
+        FSplunkLocalSinkConfig SinkConfig;
+        SinkConfig.Port      = LocalSinkPort;
+        SinkConfig.HECToken  = HECToken;
+        SinkConfig.LatencyMs = LocalSinkLatencyMs;
+        SinkConfig.ErrorRate = LocalSinkErrorRate;
+        SinkConfig.DropRate  = LocalSinkDropRate;
+        LocalSink = MakeShared<FSplunkLocalSink>(SinkConfig);
+        if (LocalSink->Start())
+        {
+            SplunkURL = LocalSink->GetURL();
+        }
+        else
+        {
+            // A test session must never fall back to the real Splunk; StartDataCollection refuses to run without the sink
+            LocalSink.Reset();
+            SplunkURL.Empty();
+        }
+    }
+
+    // Collectors only record samples; encoding, batching, compression and dispatch run on a worker.
+    // The send buffer is allocated once; its size is the mod's memory ceiling for unsent data.
+    FSplunkPipelineConfig PipelineConfig;
+    PipelineConfig.BufferCapacityBytes  = FMath::Clamp(MaxBufferMB, 1, 1024) * 1024 * 1024;
+    PipelineConfig.bEvictOldest         = BufferOverflowPolicy == ESplunkOverflowPolicy::DropOldest;
+    PipelineConfig.GetLane(ESplunkLane::Power).FlushInterval = FMath::Max(PowerLaneFlushInterval, 0.1f);
+    PipelineConfig.GetLane(ESplunkLane::Bulk).FlushInterval  = FMath::Max(BulkLaneFlushInterval, 0.0f);
+    PipelineConfig.GetLane(ESplunkLane::Metrics).bAdaptive   = bAdaptiveFlush;
+    PipelineConfig.GetLane(ESplunkLane::Events).bAdaptive    = bAdaptiveFlush;
+    PipelineConfig.GzipCompressionLevel = GzipCompressionLevel;
+    PipelineConfig.GzipMinPayloadBytes  = GzipMinPayloadBytes;
+
+    // One sender for live batches and spool replay, so MaxConcurrentRequests bounds both
+    FSplunkHttpSenderConfig SenderConfig;
+    SenderConfig.URL                   = SplunkURL;
+    SenderConfig.HECToken              = HECToken;
+    SenderConfig.MaxConcurrentRequests = FMath::Max(MaxConcurrentRequests, 1);
+    if (bUseIndexerAck)
+    {
+        // A fresh channel per session; Splunk scopes ack IDs to it
+        SenderConfig.Channel = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+        Acks = MakeUnique<FSplunkAckTracker>((int64)FMath::Max(AckMaxPendingMB, 1) * 1024 * 1024);
+        GetWorldTimerManager().SetTimer(AckPollTimer, this, &ASplunkExporter::PollAcks, FMath::Max(AckPollInterval, 0.5f), true);
+    }
+    TWeakObjectPtr<ASplunkExporter> WeakThis(this);
+    Sender = MakeShared<FSplunkHttpSender, ESPMode::ThreadSafe>(SenderConfig,
+        [WeakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        {
+            if (ASplunkExporter* Exporter = WeakThis.Get())
+            {
+                Exporter->OnHttpResponse(Request, Response, bWasSuccessful);
+            }
+        });
+
+    Pipeline = MakeUnique<FSplunkPipeline>(PipelineConfig,
+        [this](TArray<uint8>&& Body, bool bGzipped) { DispatchRequest(MoveTemp(Body), bGzipped); },
+        [Sender = Sender]() { return Sender->CanSend(); });
+    EventWriter.SetStringTable(&Pipeline->GetStringTable());
+    LayoutWriter.SetStringTable(&Pipeline->GetStringTable());
+    Names = MakeUnique<FSplunkNameCache>(Pipeline->GetStringTable());
+
+    if (bAdaptiveFlush)
+    {
+        // Healthy batches wait no longer than a fixed flush would have; the largest is what one lane may send
+        FSplunkFlushControllerConfig ControllerConfig;
+        ControllerConfig.MaxBatchBytes = PipelineConfig.GetLane(ESplunkLane::Events).MaxPayloadBytes;
+        ControllerConfig.BaseMaxAge    = FMath::Max(BufferFlushInterval, 0.5f);
+        ControllerConfig.MaxMaxAge     = FMath::Max(ControllerConfig.BaseMaxAge * 8.0f, 60.0f);
+        FlushController = MakeUnique<FSplunkFlushController>(ControllerConfig);
+        Pipeline->SetAdaptiveFlush(FlushController->GetBatchBytes(), FlushController->GetMaxAge());
+    }
+    Pipeline->Start();
+
+    // Build the actor registry once; collectors read from it instead of scanning the world
+    if (USplunkBuildableRegistry* Registry = USplunkBuildableRegistry::Get(GetWorld()))
+    {
+        Registry->Build();
+        // Foundations, walls and belts can't change circuit membership, so they don't invalidate it
+        GridChangeHandle = Registry->OnBuildableChanged().AddWeakLambda(this, [this](AFGBuildable* Building, bool)
+        {
+            if (Building && Building->FindComponentByClass<UFGPowerInfoComponent>())
+            {
+                Circuits.MarkDirty();
+            }
+        });
+        if (bCollectLayoutData && bLayoutChangeFeed)
+        {
+            LayoutChangeHandle = Registry->OnBuildableChanged().AddUObject(this, &ASplunkExporter::OnBuildableChanged);
+        }
+    }
+
+    // Anything left on disk by a previous session is replayed on the first flush
+    if (bEnableDiskSpool)
+    {
+        Spool = MakeUnique<FSplunkSpool>(FPaths::ProjectSavedDir() / TEXT("SplunkSpool"), (int64)SpoolMaxDiskMB * 1024 * 1024);
+        Spool->Open();
+        SpoolBytesOnDisk = Spool->GetDiskBytes();
+        SpoolBackoffSeconds = SpoolRetryMinSeconds;
+    }
+
     StartDataCollection();
 }
 
 void ASplunkExporter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     StopDataCollection();
-    if (DataBuffer.Num() > 0)
+    if (USplunkBuildableRegistry* Registry = USplunkBuildableRegistry::Get(GetWorld()))
     {
-        SendBufferedData();
+        Registry->OnBuildableChanged().Remove(LayoutChangeHandle);
+        Registry->OnBuildableChanged().Remove(GridChangeHandle);
+    }
+    if (Pipeline)
+    {
+        // Sends whatever is still queued or buffered and joins the worker while `this` is still valid
+        Pipeline->Shutdown();
+        Names.Reset();
+        Pipeline.Reset();
+    }
+    // Requests still in flight keep the sender alive until they complete
+    Sender.Reset();
+
+    // Unconfirmed batches are retried from disk next session rather than trusted
+    GetWorldTimerManager().ClearTimer(AckPollTimer);
+    if (Acks && Spool)
+    {
+        TArray<FSplunkAckTracker::FBatch> Unacked;
+        Acks->TakeAll(Unacked);
+        for (const FSplunkAckTracker::FBatch& Batch : Unacked)
+        {
+            Spool->Append(Batch.Body, Batch.bGzipped);
+        }
+    }
+    Acks.Reset();
+    FlushController.Reset();
+
+    if (LocalSink)
+    {
+        LocalSink->Stop();
+        LocalSink.Reset();
     }
     Super::EndPlay(EndPlayReason);
 }
 
 void ASplunkExporter::StartDataCollection()
 {
+    if (bRunLocalSink && !LocalSink)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Error,
+            TEXT("SplunkExporter: bRunLocalSink is set but the local sink could not listen on port %d. Pick a free LocalSinkPort and restart."),
+            LocalSinkPort);
+        return;
+    }
     if (HECToken.IsEmpty() || HECToken == TEXT("your-hec-token-here"))
     {
         UE_LOG(LogSatisfactorySplunkMod, Error,
@@ -90,45 +560,108 @@ void ASplunkExporter::StartDataCollection()
 
     FTimerManager& TM = World->GetTimerManager();
 
-    // Each data type gets its own independent timer.
-    // In metrics mode the timer calls an aggregated collector.
+    // Each data type gets its own independent timer, with the same interval in both modes.
+    // In metrics mode the timer calls CollectMetrics for its aggregator, in its own phase slot.
     // In events mode the timer calls a detailed per-machine collector.
-    // The same interval settings apply to both modes.
+    const bool bMetrics = IsMetricsModeActive();
+
+    struct FTask
+    {
+        FTimerHandle* Handle;
+        FTimerDelegate Delegate;
+    };
+    TArray<FTask, TInlineAllocator<7>> Tasks;
+    Schedule.Reset();
 
+    auto AddTask = [&Tasks, this](const TCHAR* Name, float Interval, bool bHeavy, FTimerHandle& Handle, FTimerDelegate&& Delegate)
+    {
+        Tasks.Add({ &Handle, MoveTemp(Delegate) });
+        FSplunkScheduleEntry& Entry = Schedule.AddDefaulted_GetRef();
+        Entry.Name = Name;
+        Entry.Interval = Interval;
+        Entry.bHeavy = bHeavy;
+    };
+
+    // Heavy collectors go first so they get the widest spacing between their slots
     if (bCollectPowerData)
     {
-        TM.SetTimer(PowerTimer, this,
-            bUseMetricsMode ? &ASplunkExporter::CollectPowerMetrics : &ASplunkExporter::CollectPowerData,
-            PowerInterval, true);
+        AddTask(TEXT("Power"), PowerInterval, true, PowerTimer,
+            MakeCollectorDelegate(ESplunkMetrics::Power));
     }
     if (bCollectProductionData)
     {
-        TM.SetTimer(ProductionTimer, this,
-            bUseMetricsMode ? &ASplunkExporter::CollectProductionMetrics : &ASplunkExporter::CollectProductionData,
-            ProductionInterval, true);
+        AddTask(TEXT("Production"), ProductionInterval, true, ProductionTimer,
+            MakeCollectorDelegate(ESplunkMetrics::Production));
     }
     if (bCollectVehicleData)
     {
-        TM.SetTimer(VehicleTimer, this,
-            bUseMetricsMode ? &ASplunkExporter::CollectVehicleMetrics : &ASplunkExporter::CollectAllVehicleData,
-            VehicleInterval, true);
+        AddTask(TEXT("Vehicles"), VehicleInterval, true, VehicleTimer,
+            MakeCollectorDelegate(ESplunkMetrics::Vehicles));
     }
     if (bCollectPlayerData)
     {
-        TM.SetTimer(PlayerTimer, this,
-            bUseMetricsMode ? &ASplunkExporter::CollectPlayerMetrics : &ASplunkExporter::CollectPlayerMovementSystems,
-            PlayerInterval, true);
+        AddTask(TEXT("Players"), PlayerInterval, true, PlayerTimer,
+            MakeCollectorDelegate(ESplunkMetrics::Players));
+    }
+    // Scheduled whenever events mode is configured, so degrading to metrics only has to pause it
+    if (bCollectLayoutData && !bUseMetricsMode)
+    {
+        AddTask(TEXT("Layout"), LayoutInterval, true, LayoutTimer,
+            FTimerDelegate::CreateUObject(this, &ASplunkExporter::CollectFactoryLayoutData));
+    }
+    if (bCollectPowerData && PowerAlertInterval > 0.0f)
+    {
+        AddTask(TEXT("PowerAlerts"), FMath::Max(PowerAlertInterval, 0.1f), false, PowerAlertTimer,
+            FTimerDelegate::CreateUObject(this, &ASplunkExporter::CheckPowerAlerts));
     }
+    AddTask(TEXT("Flush"), BufferFlushInterval, false, BufferFlushTimer,
+        FTimerDelegate::CreateUObject(this, &ASplunkExporter::CheckAndFlushBuffer));
 
-    TM.SetTimer(BufferFlushTimer, this, &ASplunkExporter::CheckAndFlushBuffer, BufferFlushInterval, true);
+    // Without phases every timer started together and they all landed on one frame each common period
+    FSplunkScheduler::AssignPhases(Schedule);
+    for (int32 i = 0; i < Tasks.Num(); i++)
+    {
+        const FSplunkScheduleEntry& Entry = Schedule[i];
+        TM.SetTimer(*Tasks[i].Handle, Tasks[i].Delegate, Entry.Interval, true, Entry.Interval + Entry.Phase);
+    }
+    if (bDegradedToMetrics)
+    {
+        TM.PauseTimer(LayoutTimer);
+    }
+
+    // The change feed is only useful on top of a baseline, so take one now rather than an interval from now,
+    // but only if this session hasn't sent one yet
+    if (TM.IsTimerActive(LayoutTimer) && bLayoutChangeFeed && !bLayoutBaselineSent)
+    {
+        CollectFactoryLayoutData();
+    }
+
+    // Circuit membership builds up over frames, so start it now for the first power slot to find it ready
+    if (bCollectPowerData)
+    {
+        RefreshCircuits();
+    }
 
     bIsCollecting = true;
     LastBufferFlush = FDateTime::Now();
 
     UE_LOG(LogSatisfactorySplunkMod, Log,
         TEXT("SplunkExporter: Collection started (%s mode) - Power: %.1fs  Production: %.1fs  Vehicles: %.1fs  Players: %.1fs"),
-        bUseMetricsMode ? TEXT("Metrics") : TEXT("Events"),
+        bMetrics ? TEXT("Metrics") : TEXT("Events"),
         PowerInterval, ProductionInterval, VehicleInterval, PlayerInterval);
+
+    for (const FSplunkScheduleEntry& Entry : Schedule)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Verbose, TEXT("SplunkExporter: Schedule %-10s every %.2fs, phase +%.2fs%s"),
+            *Entry.Name, Entry.Interval, Entry.Phase, Entry.bHeavy ? TEXT(" (heavy)") : TEXT(""));
+    }
+}
+
+bool ASplunkExporter::ClaimCollectorFrame()
+{
+    if (HeavyCollectorFrame == GFrameCounter) return false;
+    HeavyCollectorFrame = GFrameCounter;
+    return true;
 }
 
 void ASplunkExporter::StopDataCollection()
@@ -141,7 +674,24 @@ void ASplunkExporter::StopDataCollection()
     TM.ClearTimer(ProductionTimer);
     TM.ClearTimer(VehicleTimer);
     TM.ClearTimer(PlayerTimer);
+    TM.ClearTimer(LayoutTimer);
     TM.ClearTimer(BufferFlushTimer);
+    TM.ClearTimer(PowerAlertTimer);
+    Schedule.Reset();
+
+    // Abandon sweeps in progress; whatever they already wrote stays buffered
+    for (FCollectorSweep& Sweep : Sweeps)
+    {
+        Sweep.bActive = false;
+    }
+    LayoutWriter.Reset();
+    Circuits.Reset();
+    PowerAlerts.Reset();
+    for (FSplunkMachineStore& Store : MachineStores)
+    {
+        Store.Reset();
+    }
+    SetActorTickEnabled(false);
 
     bIsCollecting = false;
     UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkExporter: Data collection stopped"));
@@ -177,872 +727,987 @@ void ASplunkExporter::CollectAndSendData()
     {
         CollectPowerData();
     }
+
+    // This is an explicit full cycle, so finish the sweeps now instead of spreading them over frames
+    AdvanceSweeps(TNumericLimits<double>::Max());
     
-    // Update buffer count
-    EventsInBuffer = DataBuffer.Num();
+    // Update buffer count (published by the pipeline worker, so it may not include this cycle yet)
+    EventsInBuffer = Pipeline ? Pipeline->GetBufferedEvents() : 0;
     
-    // Send buffered data if we have enough
-    if (DataBuffer.Num() >= BatchSize)
+    // Send buffered data if we have enough; adaptive lanes size their own batches
+    if (!FlushController && EventsInBuffer >= BatchSize)
     {
         SendBufferedData();
     }
     
-    UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkExporter: Data collection cycle completed. Buffer size: %d"), DataBuffer.Num());
+    UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkExporter: Data collection cycle completed. Buffer size: %d"), EventsInBuffer);
 }
 
 void ASplunkExporter::SendBufferedData()
 {
-    if (DataBuffer.Num() == 0)
+    // Batching, compression and dispatch happen on the pipeline worker
+    if (Pipeline)
     {
-        return;
+        Pipeline->RequestFlush();
+        EventsInBuffer = Pipeline->GetBufferedEvents();
     }
+}
 
-    // Splunk HEC batch format: one JSON object per line (NOT wrapped in an array)
-    FString BatchString;
-    for (auto& Event : DataBuffer)
+void ASplunkExporter::CommitEvent(ESplunkLane Lane, bool bEvictOldest)
+{
+    EventWriter.EndEvent();
+    if (Pipeline)
     {
-        FString EventString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&EventString);
-        FJsonSerializer::Serialize(Event.ToSharedRef(), Writer);
-        BatchString += EventString + TEXT("\n");
+        Pipeline->Submit(EventWriter.GetSamples(), Lane, bEvictOldest);
     }
-
-    UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkExporter: Sending batch of %d events to Splunk"), DataBuffer.Num());
-
-    SendDataToSplunk(BatchString);
-    DataBuffer.Empty();
-    EventsInBuffer = 0;
+    EventWriter.Reset();
 }
 
-TSharedPtr<FJsonObject> ASplunkExporter::CreateBaseEvent(const FString& SourceType)
+void ASplunkExporter::UpdateBackpressure()
 {
-    TSharedPtr<FJsonObject> EventObject = MakeShareable(new FJsonObject);
-    
-    EventObject->SetStringField(TEXT("time"), FString::Printf(TEXT("%.0f"), FDateTime::Now().ToUnixTimestamp()));
-    EventObject->SetStringField(TEXT("host"), TEXT("satisfactory-game"));
-    EventObject->SetStringField(TEXT("sourcetype"), SourceType);
-    
-    return EventObject;
+    if (!Pipeline) return;
+    EventsDroppedTotal = Pipeline->GetDroppedEvents();
+    EventsInBuffer = Pipeline->GetBufferedEvents();
+
+    if (BufferOverflowPolicy != ESplunkOverflowPolicy::DegradeToMetrics || bUseMetricsMode) return;
+
+    // Hysteresis: degrade near full, restore detailed events only once most of the backlog is gone.
+    // Only the events lane is relieved by degrading, so only its fill counts.
+    const float Fill = Pipeline->GetLaneFillRatio(ESplunkLane::Events);
+    const bool bShouldDegrade = bDegradedToMetrics
+        ? Fill > SplunkExporter::RecoverFillRatio
+        : (Fill >= SplunkExporter::DegradeFillRatio || EventsDroppedTotal > LastReportedDroppedEvents);
+
+    if (bShouldDegrade == bDegradedToMetrics) return;
+
+    UE_LOG(LogSatisfactorySplunkMod, Warning,
+        TEXT("SplunkExporter: Send buffer %.0f%% full - %s"), Fill * 100.0f,
+        bShouldDegrade ? TEXT("degrading events mode to metrics mode") : TEXT("restoring events mode"));
+
+    bDegradedToMetrics = bShouldDegrade;
+    RebindCollectors();
 }
 
-void ASplunkExporter::AddEventToBuffer(TSharedPtr<FJsonObject> EventObject)
+FTimerDelegate ASplunkExporter::MakeCollectorDelegate(ESplunkMetrics Kind)
 {
-    if (EventObject.IsValid())
+    if (IsMetricsModeActive())
+    {
+        return FTimerDelegate::CreateUObject(this, &ASplunkExporter::CollectMetrics, Kind);
+    }
+    switch (Kind)
     {
-        DataBuffer.Add(EventObject);
+        case ESplunkMetrics::Power:      return FTimerDelegate::CreateUObject(this, &ASplunkExporter::CollectPowerData);
+        case ESplunkMetrics::Production: return FTimerDelegate::CreateUObject(this, &ASplunkExporter::CollectProductionData);
+        case ESplunkMetrics::Vehicles:   return FTimerDelegate::CreateUObject(this, &ASplunkExporter::CollectAllVehicleData);
+        case ESplunkMetrics::Players:    return FTimerDelegate::CreateUObject(this, &ASplunkExporter::CollectPlayerMovementSystems);
+        default:                         return FTimerDelegate();
     }
 }
 
-void ASplunkExporter::CollectProductionData()
+void ASplunkExporter::RebindCollectors()
 {
     UWorld* World = GetWorld();
-    if (!World) return;
+    if (!World || !bIsCollecting) return;
 
-    // Collect manufacturer data
-    for (TActorIterator<AFGBuildableManufacturer> ActorItr(World); ActorItr; ++ActorItr)
+    // Stores, circuit membership, alert baselines and running sweeps carry over; a restart would drop them
+    // and re-phase every timer. Each timer keeps its rate and the time left to its next run.
+    FTimerManager& TM = World->GetTimerManager();
+    auto Rebind = [this, &TM](FTimerHandle& Handle, ESplunkMetrics Kind)
+    {
+        if (!TM.IsTimerActive(Handle)) return;
+        const float Rate = TM.GetTimerRate(Handle);
+        const float Remaining = FMath::Max(TM.GetTimerRemaining(Handle), 0.0f);
+        TM.SetTimer(Handle, MakeCollectorDelegate(Kind), Rate, true, Remaining);
+    };
+    Rebind(PowerTimer, ESplunkMetrics::Power);
+    Rebind(ProductionTimer, ESplunkMetrics::Production);
+    Rebind(VehicleTimer, ESplunkMetrics::Vehicles);
+    Rebind(PlayerTimer, ESplunkMetrics::Players);
+
+    // Layout snapshots are events-mode only; a paused timer resumes where it stopped
+    if (bDegradedToMetrics)
+    {
+        TM.PauseTimer(LayoutTimer);
+    }
+    else
     {
-        AFGBuildableManufacturer* Manufacturer = *ActorItr;
-        if (!Manufacturer || !Manufacturer->IsValidLowLevel()) continue;
+        TM.UnPauseTimer(LayoutTimer);
+    }
+}
 
-        TSharedPtr<FJsonObject> EventObject = CreateBaseEvent(TEXT("satisfactory:production"));
-        TSharedPtr<FJsonObject> EventData = MakeShareable(new FJsonObject);
-        
-        // Machine data
-        EventData->SetStringField(TEXT("machine_type"), TEXT("Manufacturer"));
-        EventData->SetStringField(TEXT("machine_id"), Manufacturer->GetName());
-        EventData->SetNumberField(TEXT("power_consumption"), Manufacturer->GetPowerConsumption());
-        EventData->SetNumberField(TEXT("efficiency"), Manufacturer->GetProductionEfficiency());
-        
-        // Recipe information
-        TSubclassOf<class UFGRecipe> CurrentRecipe = Manufacturer->GetCurrentRecipe();
-        if (CurrentRecipe)
+void ASplunkExporter::EmitBufferMetrics()
+{
+    if (!Pipeline) return;
+
+    // The worker publishes these after every drain, so they may trail the game thread by a few ms
+    const int64 DroppedTotal = Pipeline->GetDroppedEvents();
+
+    EventWriter.BeginMetricsEvent(GetEventTime());
+    EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.buffer.events"),        Pipeline->GetBufferedEvents());
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.buffer.bytes"),         Pipeline->GetBufferedBytes());
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.dropped.events"),       DroppedTotal - LastReportedDroppedEvents);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.dropped.events_total"), DroppedTotal);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.dropped.bytes_total"),  Pipeline->GetDroppedBytes());
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.queue.waits_total"),    Pipeline->GetQueueWaits());
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.degraded"),             bDegradedToMetrics ? 1 : 0);
+
+    // Worker-side encode and compression cost
+    const int64 PayloadBytes = Pipeline->GetPayloadBytes();
+    const int64 DispatchedBytes = Pipeline->GetDispatchedBytes();
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.encoded.events_total"),  Pipeline->GetEncodedEvents());
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.encoded.bytes_total"),   PayloadBytes);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.sent.bytes_total"),      DispatchedBytes);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.compression.ratio"),  DispatchedBytes > 0 ? (double)PayloadBytes / DispatchedBytes : 1.0);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.worker.encode_us_total"),   Pipeline->GetEncodeMicros());
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.worker.compress_us_total"), Pipeline->GetCompressMicros());
+
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.retry.spooled_total"),  BatchesSpooledTotal);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.retry.replayed_total"), BatchesReplayedTotal);
+    if (Sender)
+    {
+        HttpRequestsInFlight = Sender->GetInFlight();
+        HttpLatencyMs = Sender->GetAverageLatencyMs();
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.http.in_flight"),        HttpRequestsInFlight);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.http.latency_ms"),     HttpLatencyMs);
+    }
+    if (Acks)
+    {
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.ack.pending"),       Acks->Num());
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.ack.pending_bytes"), Acks->GetPendingBytes());
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.ack.acked_total"),   Acks->GetAckedTotal());
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.ack.resent_total"),  BatchesResentTotal);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.ack.evicted_total"), Acks->GetEvictedTotal());
+    }
+    if (bDeltaMode)
+    {
+        int64 DeltaSent = 0;
+        int64 DeltaSuppressed = 0;
+        for (const FSplunkDeltaTracker& Tracker : MachineDeltas)
         {
-            UFGRecipe* Recipe = CurrentRecipe->GetDefaultObject<UFGRecipe>();
-            if (Recipe)
-            {
-                EventData->SetStringField(TEXT("recipe_name"), Recipe->GetDisplayName().ToString());
-
-                TArray<FItemAmount> Products = Recipe->GetProducts();
-                TArray<FItemAmount> Ingredients = Recipe->GetIngredients();
-
-                if (Products.Num() > 0 && Products[0].ItemClass)
-                {
-                    UFGItemDescriptor* ProductDesc = Products[0].ItemClass->GetDefaultObject<UFGItemDescriptor>();
-                    if (ProductDesc)
-                    {
-                        EventData->SetStringField(TEXT("output_item"), ProductDesc->GetDisplayName().ToString());
-                        EventData->SetNumberField(TEXT("output_rate"), Products[0].Amount);
-                    }
-                }
-
-                if (Ingredients.Num() > 0 && Ingredients[0].ItemClass)
-                {
-                    UFGItemDescriptor* IngredientDesc = Ingredients[0].ItemClass->GetDefaultObject<UFGItemDescriptor>();
-                    if (IngredientDesc)
-                    {
-                        EventData->SetStringField(TEXT("input_item"), IngredientDesc->GetDisplayName().ToString());
-                        EventData->SetNumberField(TEXT("input_rate"), Ingredients[0].Amount);
-                    }
-                }
-                
-                // Handle multi-input recipes
-                if (Ingredients.Num() > 1)
-                {
-                    TArray<TSharedPtr<FJsonValue>> SecondaryInputs;
-                    for (int32 i = 1; i < Ingredients.Num(); i++)
-                    {
-                        if (Ingredients[i].ItemClass)
-                        {
-                            UFGItemDescriptor* IngredientDesc = Ingredients[i].ItemClass->GetDefaultObject<UFGItemDescriptor>();
-                            if (IngredientDesc)
-                            {
-                                TSharedPtr<FJsonObject> InputObj = MakeShareable(new FJsonObject);
-                                InputObj->SetStringField(TEXT("item"), IngredientDesc->GetDisplayName().ToString());
-                                InputObj->SetNumberField(TEXT("rate"), Ingredients[i].Amount);
-                                SecondaryInputs.Add(MakeShareable(new FJsonValueObject(InputObj)));
-                            }
-                        }
-                    }
-                    if (SecondaryInputs.Num() > 0)
-                    {
-                        EventData->SetArrayField(TEXT("secondary_inputs"), SecondaryInputs);
-                    }
-                }
-            }
+            DeltaSent       += Tracker.GetSentTotal();
+            DeltaSuppressed += Tracker.GetSuppressedTotal();
         }
-        
-        // Location data
-        FVector Location = Manufacturer->GetActorLocation();
-        EventData->SetNumberField(TEXT("location_x"), Location.X);
-        EventData->SetNumberField(TEXT("location_y"), Location.Y);
-        EventData->SetNumberField(TEXT("location_z"), Location.Z);
-        
-        EventObject->SetObjectField(TEXT("event"), EventData);
-        AddEventToBuffer(EventObject);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.delta.sent_total"),       DeltaSent);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.delta.suppressed_total"), DeltaSuppressed);
     }
-    
-    // Collect resource extractor data
-    for (TActorIterator<AFGBuildableResourceExtractor> ActorItr(World); ActorItr; ++ActorItr)
+    if (LayoutChangeHandle.IsValid())
+    {
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.layout.changes_total"), LayoutChangeSeq);
+    }
+    if (FlushController)
+    {
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.flush.batch_bytes"),          FlushController->GetBatchBytes());
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.flush.max_age_s"),         FlushController->GetMaxAge());
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.flush.latency_ms"),        FlushController->GetSmoothedLatencyMs());
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.flush.baseline_latency_ms"), FlushController->GetBaselineLatencyMs());
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.flush.error_rate"),        FlushController->GetErrorRate());
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.flush.increases_total"),      FlushController->GetIncreases());
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.flush.decreases_total"),      FlushController->GetDecreases());
+    }
+    if (PowerAlertTimer.IsValid())
+    {
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.power.alerts_total"), PowerAlertsTotal);
+    }
+    if (Circuits.GetRebuildCount() > 0)
     {
-        AFGBuildableResourceExtractor* Extractor = *ActorItr;
-        if (!Extractor || !Extractor->IsValidLowLevel()) continue;
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.circuits.rebuilds_total"), Circuits.GetRebuildCount());
+    }
+    EventWriter.EndObject();
 
-        TSharedPtr<FJsonObject> EventObject = CreateBaseEvent(TEXT("satisfactory:extraction"));
-        TSharedPtr<FJsonObject> EventData = MakeShareable(new FJsonObject);
-        
-        EventData->SetStringField(TEXT("machine_type"), TEXT("Extractor"));
-        EventData->SetStringField(TEXT("machine_id"), Extractor->GetName());
-        EventData->SetNumberField(TEXT("power_consumption"), Extractor->GetPowerConsumption());
-        EventData->SetNumberField(TEXT("efficiency"), Extractor->GetProductionEfficiency());
-        EventData->SetNumberField(TEXT("extraction_rate"), Extractor->GetExtractionRate());
-        
-        // Resource type
-        TSubclassOf<UFGResourceDescriptor> ResourceClass = Extractor->GetResourceClass();
-        if (ResourceClass)
-        {
-            UFGResourceDescriptor* ResourceDesc = ResourceClass->GetDefaultObject<UFGResourceDescriptor>();
-            if (ResourceDesc)
-            {
-                EventData->SetStringField(TEXT("resource_type"), ResourceDesc->GetDisplayName().ToString());
-            }
-        }
-        
-        FVector Location = Extractor->GetActorLocation();
-        EventData->SetNumberField(TEXT("location_x"), Location.X);
-        EventData->SetNumberField(TEXT("location_y"), Location.Y);
-        EventData->SetNumberField(TEXT("location_z"), Location.Z);
-        
-        EventObject->SetObjectField(TEXT("event"), EventData);
-        AddEventToBuffer(EventObject);
+    // Self-metrics must survive a full buffer, otherwise drops would never be reported
+    CommitEvent(ESplunkLane::Metrics, true);
+
+    for (int32 i = 0; i < (int32)ESplunkLane::Num; i++)
+    {
+        const ESplunkLane Lane = (ESplunkLane)i;
+        const FSplunkPipeline::FLaneStats& Stats = Pipeline->GetLaneStats(Lane);
+        EventWriter.BeginMetricsEvent(GetEventTime());
+        EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+        EventWriter.WriteString(SPLUNK_HEC_KEY("lane"), FSplunkPipeline::GetLaneName(Lane));
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.lane.buffer.events"),      Stats.BufferedEvents.load(std::memory_order_relaxed));
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.lane.buffer.bytes"),       Stats.BufferedBytes.load(std::memory_order_relaxed));
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.lane.dropped.events_total"), Stats.DroppedEvents.load(std::memory_order_relaxed));
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.lane.batches_total"),      Stats.Batches.load(std::memory_order_relaxed));
+        EventWriter.EndObject();
+        CommitEvent(ESplunkLane::Metrics, true);
+    }
+
+    if (DroppedTotal > LastReportedDroppedEvents)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Warning,
+            TEXT("SplunkExporter: Send buffer full - dropped %lld events since last flush (%lld total)"),
+            DroppedTotal - LastReportedDroppedEvents, DroppedTotal);
     }
+    LastReportedDroppedEvents = DroppedTotal;
 }
 
-void ASplunkExporter::CollectPowerData()
+void ASplunkExporter::EmitTimingMetrics()
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    const int64 Time = GetEventTime();
 
-    // Get power subsystem
-    AFGBuildableSubsystem* BuildableSubsystem = AFGBuildableSubsystem::Get(World);
-    if (!BuildableSubsystem) return;
-
-    // Collect power generator data
-    for (TActorIterator<AFGBuildablePowerGenerator> ActorItr(World); ActorItr; ++ActorItr)
+    // One event per collector with "collector" as the dimension; idle collectors are skipped
+    static const FSplunkHECToken SweepNames[] =
     {
-        AFGBuildablePowerGenerator* Generator = *ActorItr;
-        if (!Generator || !Generator->IsValidLowLevel()) continue;
-
-        TSharedPtr<FJsonObject> EventObject = CreateBaseEvent(TEXT("satisfactory:power:generator"));
-        TSharedPtr<FJsonObject> EventData = MakeShareable(new FJsonObject);
-        
-        EventData->SetStringField(TEXT("generator_type"), Generator->GetClass()->GetName());
-        EventData->SetStringField(TEXT("generator_id"), Generator->GetName());
-        EventData->SetNumberField(TEXT("power_production"), Generator->GetPowerProduction());
-        EventData->SetNumberField(TEXT("max_power_production"), Generator->GetMaxPowerProduction());
-        EventData->SetNumberField(TEXT("efficiency"), Generator->GetProductionEfficiency());
-        EventData->SetBoolField(TEXT("is_producing"), Generator->IsProducing());
-        
-        // Location
-        FVector Location = Generator->GetActorLocation();
-        EventData->SetNumberField(TEXT("location_x"), Location.X);
-        EventData->SetNumberField(TEXT("location_y"), Location.Y);
-        EventData->SetNumberField(TEXT("location_z"), Location.Z);
-        
-        // Fuel data for fuel-powered generators
-        if (AFGBuildablePowerGeneratorFuel* FuelGenerator = Cast<AFGBuildablePowerGeneratorFuel>(Generator))
-        {
-            UFGInventoryComponent* FuelInventory = FuelGenerator->GetFuelInventory();
-            if (FuelInventory)
-            {
-                float TotalFuelEnergy = 0.0f;
-                int32 FuelStacks = 0;
-                
-                for (int32 i = 0; i < FuelInventory->GetSizeLinear(); i++)
-                {
-                    FInventoryStack Stack;
-                    if (FuelInventory->GetStackFromIndex(i, Stack) && !Stack.Item.ItemClass.IsNull())
-                    {
-                        FuelStacks++;
-                        UFGItemDescriptor* ItemDesc = Stack.Item.ItemClass->GetDefaultObject<UFGItemDescriptor>();
-                        
-                        // Get energy value based on fuel type
-                        float EnergyValue = 100.0f; // Default
-                        if (UFGItemDescriptorNuclearFuel* NuclearFuel = Cast<UFGItemDescriptorNuclearFuel>(ItemDesc))
-                        {
-                            EnergyValue = NuclearFuel->GetEnergyValue();
-                        }
-                        else if (UFGItemDescriptorBiomass* BiomassFuel = Cast<UFGItemDescriptorBiomass>(ItemDesc))
-                        {
-                            EnergyValue = BiomassFuel->GetEnergyValue();
-                        }
-                        
-                        TotalFuelEnergy += EnergyValue * Stack.NumItems;
-                    }
-                }
-                
-                EventData->SetNumberField(TEXT("fuel_energy_available"), TotalFuelEnergy);
-                EventData->SetNumberField(TEXT("fuel_stacks"), FuelStacks);
-            }
-        }
-        
-        EventObject->SetObjectField(TEXT("event"), EventData);
-        AddEventToBuffer(EventObject);
+        SPLUNK_HEC_STRING("manufacturers"),
+        SPLUNK_HEC_STRING("extractors"),
+        SPLUNK_HEC_STRING("generators"),
+        SPLUNK_HEC_STRING("vehicles"),
+        SPLUNK_HEC_STRING("trains"),
+        SPLUNK_HEC_STRING("players"),
+        SPLUNK_HEC_STRING("layout"),
+        SPLUNK_HEC_STRING("circuits"),
+    };
+    static_assert(UE_ARRAY_COUNT(SweepNames) == (int32)ESplunkSweep::Num, "One name per sweep");
+
+    WriteTimingEvent(Time, SPLUNK_HEC_STRING("metrics_pass"), MetricsPassTiming);
+    for (int32 i = 0; i < (int32)ESplunkSweep::Num; i++)
+    {
+        WriteTimingEvent(Time, SweepNames[i], SweepTimings[i]);
+    }
+    if (Sender)
+    {
+        WriteTimingEvent(Time, SPLUNK_HEC_STRING("http_request"), Sender->GetLatencyHistogram());
     }
 
-    // TODO: Implement power circuit collection
-    // Power circuits need to be retrieved from the power subsystem
-    // Current API for accessing power circuits is unclear and needs investigation
+    for (const TPair<int32, int64>& Status : HttpStatusCounts)
+    {
+        EventWriter.BeginMetricsEvent(Time);
+        EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+        EventWriter.WriteString(SPLUNK_HEC_KEY("status_code"), FString::FromInt(Status.Key));
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.http.responses_total"), Status.Value);
+        EventWriter.EndObject();
+        CommitEvent(ESplunkLane::Metrics, true);
+    }
 }
 
-void ASplunkExporter::CollectAllVehicleData()
+void ASplunkExporter::WriteTimingEvent(int64 Time, FSplunkHECToken Collector, FSplunkHistogram& Histogram)
 {
-    CollectPersonalVehicles();
-    CollectTrainData();
+    if (Histogram.GetCount() == 0) return;
+
+    EventWriter.BeginMetricsEvent(Time);
+    EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+    EventWriter.WriteString(SPLUNK_HEC_KEY("collector"), Collector);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.timing.count"),     Histogram.GetCount());
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.timing.p50_ms"), Histogram.GetPercentile(0.5) / 1000.0);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.timing.p99_ms"), Histogram.GetPercentile(0.99) / 1000.0);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:satisfactory.exporter.timing.max_ms"), Histogram.GetMax() / 1000.0);
+    EventWriter.EndObject();
+    CommitEvent(ESplunkLane::Metrics, true);
+
+    Histogram.Reset();
 }
 
-FString ASplunkExporter::GetVehicleTypeFromClass(const FString& ClassName)
+void ASplunkExporter::Tick(float DeltaSeconds)
 {
-    if (ClassName.Contains(TEXT("Tractor")))
-    {
-        return TEXT("Tractor");
-    }
-    else if (ClassName.Contains(TEXT("Explorer")))
+    Super::Tick(DeltaSeconds);
+
+    // A budgeted slice is bounded, so it shares the frame with a metrics pass rather than claiming it:
+    // Tick runs before the timers, and a claim here would push every pass back while any sweep is active
+    if (CollectorFrameBudgetMs > 0.0f)
     {
-        return TEXT("Explorer");
+        AdvanceSweeps(FPlatformTime::Seconds() + CollectorFrameBudgetMs / 1000.0);
+        return;
     }
-    else if (ClassName.Contains(TEXT("CyberWagon")))
+
+    // Slicing disabled: the rest of each sweep runs at once, which is as heavy as any timer pass
+    if (!ClaimCollectorFrame()) return;
+    AdvanceSweeps(TNumericLimits<double>::Max());
+}
+
+void ASplunkExporter::BeginSweep(ESplunkSweep Kind)
+{
+    FCollectorSweep& Sweep = Sweeps[(int32)Kind];
+    if (Sweep.bActive)
     {
-        return TEXT("CyberWagon");
+        // The previous sweep hasn't finished within one interval; let it complete rather than restart
+        UE_LOG(LogSatisfactorySplunkMod, Verbose, TEXT("SplunkExporter: Sweep %d still running, skipping this interval"), (int32)Kind);
+        return;
     }
-    else if (ClassName.Contains(TEXT("Cart")))
+
+    Sweep.bActive = true;
+    Sweep.Cursor = 0;
+    Sweep.Time = GetEventTime();
+    Sweep.Page = 0;
+    Sweep.PageFill = 0;
+
+    // In delta mode only changed machines are sent, except on a periodic keyframe that sends everything
+    Sweep.bKeyframe = !bDeltaMode || Sweep.Time >= Sweep.NextKeyframeTime;
+    if (bDeltaMode && Sweep.bKeyframe)
     {
-        return TEXT("FactoryCart");
+        Sweep.NextKeyframeTime = Sweep.Time + FMath::Max(FMath::RoundToInt(DeltaKeyframeInterval), 1);
     }
-    else if (ClassName.Contains(TEXT("Truck")))
+
+    if (CollectorFrameBudgetMs <= 0.0f && ClaimCollectorFrame())
     {
-        return TEXT("Truck");
+        // Slicing disabled: run the whole sweep inside the timer callback
+        AdvanceSweeps(TNumericLimits<double>::Max());
+        return;
     }
-    
-    return TEXT("Unknown");
+    SetActorTickEnabled(true);
 }
 
-void ASplunkExporter::CollectPersonalVehicles()
+void ASplunkExporter::AdvanceSweeps(double Deadline)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    USplunkBuildableRegistry* Registry = USplunkBuildableRegistry::Get(GetWorld());
+    if (!Registry) return;
 
-    for (TActorIterator<AFGWheeledVehicle> ActorItr(World); ActorItr; ++ActorItr)
+    // Start with a different sweep each frame so one large list can't starve the others
+    const int32 NumSweeps = UE_ARRAY_COUNT(Sweeps);
+    for (int32 i = 0; i < NumSweeps; i++)
     {
-        AFGWheeledVehicle* Vehicle = *ActorItr;
-        if (!Vehicle || !Vehicle->IsValidLowLevel()) continue;
+        const int32 Index = (NextSweepIndex + i) % NumSweeps;
+        FCollectorSweep& Sweep = Sweeps[Index];
+        if (!Sweep.bActive) continue;
 
-        bool bIsPlayerDriven = Vehicle->IsPlayerDriven();
-        bool bIsAutomated = Vehicle->IsAutoPilotEnabled();
-        
-        TSharedPtr<FJsonObject> EventObject;
-        if (bIsAutomated)
-        {
-            EventObject = CreateBaseEvent(TEXT("satisfactory:vehicle:automated"));
-        }
-        else
-        {
-            EventObject = CreateBaseEvent(TEXT("satisfactory:vehicle:personal"));
-        }
-        
-        TSharedPtr<FJsonObject> EventData = MakeShareable(new FJsonObject);
-        
-        FString VehicleClass = Vehicle->GetClass()->GetName();
-        FString VehicleType = GetVehicleTypeFromClass(VehicleClass);
-        
-        EventData->SetStringField(TEXT("vehicle_type"), VehicleType);
-        EventData->SetStringField(TEXT("vehicle_id"), Vehicle->GetName());
-        EventData->SetBoolField(TEXT("is_player_driven"), bIsPlayerDriven);
-        EventData->SetBoolField(TEXT("is_automated"), bIsAutomated);
-        
-        // Position and movement
-        FVector Location = Vehicle->GetActorLocation();
-        FVector Velocity = Vehicle->GetVelocity();
-        FRotator Rotation = Vehicle->GetActorRotation();
-        
-        EventData->SetNumberField(TEXT("location_x"), Location.X);
-        EventData->SetNumberField(TEXT("location_y"), Location.Y);
-        EventData->SetNumberField(TEXT("location_z"), Location.Z);
-        EventData->SetNumberField(TEXT("speed"), Velocity.Size());
-        EventData->SetNumberField(TEXT("heading"), Rotation.Yaw);
-        EventData->SetNumberField(TEXT("pitch"), Rotation.Pitch);
-        EventData->SetNumberField(TEXT("roll"), Rotation.Roll);
-        
-        // Player information if player-driven
-        if (bIsPlayerDriven)
-        {
-            APawn* Driver = Vehicle->GetInstigator();
-            if (Driver)
-            {
-                EventData->SetStringField(TEXT("driver_name"), Driver->GetName());
-                
-                APlayerController* PC = Cast<APlayerController>(Driver->GetController());
-                if (PC)
-                {
-                    EventData->SetStringField(TEXT("player_id"), PC->GetName());
-                }
-            }
-        }
-        
-        // Fuel system
-        UFGInventoryComponent* FuelInventory = Vehicle->GetFuelInventory();
-        if (FuelInventory)
-        {
-            TArray<TSharedPtr<FJsonValue>> FuelArray;
-            float TotalFuelEnergy = 0.0f;
-            float MaxFuelEnergy = 0.0f;
-            
-            for (int32 i = 0; i < FuelInventory->GetSizeLinear(); i++)
-            {
-                FInventoryStack Stack;
-                if (FuelInventory->GetStackFromIndex(i, Stack) && !Stack.Item.ItemClass.IsNull())
-                {
-                    TSharedPtr<FJsonObject> FuelItem = MakeShareable(new FJsonObject);
-                    UFGItemDescriptor* ItemDesc = Stack.Item.ItemClass->GetDefaultObject<UFGItemDescriptor>();
-                    
-                    FuelItem->SetStringField(TEXT("fuel_type"), ItemDesc->GetDisplayName().ToString());
-                    FuelItem->SetNumberField(TEXT("quantity"), Stack.NumItems);
-                    
-                    // Calculate energy value
-                    float EnergyValue = 100.0f; // Default energy value
-                    UFGItemDescriptorNuclearFuel* NuclearFuel = Cast<UFGItemDescriptorNuclearFuel>(ItemDesc);
-                    UFGItemDescriptorBiomass* BiomassFuel = Cast<UFGItemDescriptorBiomass>(ItemDesc);
-                    
-                    if (NuclearFuel)
-                    {
-                        EnergyValue = NuclearFuel->GetEnergyValue();
-                    }
-                    else if (BiomassFuel)
-                    {
-                        EnergyValue = BiomassFuel->GetEnergyValue();
-                    }
-                    
-                    TotalFuelEnergy += EnergyValue * Stack.NumItems;
-                    FuelItem->SetNumberField(TEXT("energy_value"), EnergyValue);
-                    
-                    FuelArray.Add(MakeShareable(new FJsonValueObject(FuelItem)));
-                }
-                
-                MaxFuelEnergy += 100.0f; // Approximate max energy per slot
-            }
-            
-            EventData->SetArrayField(TEXT("fuel_items"), FuelArray);
-            EventData->SetNumberField(TEXT("fuel_energy_current"), TotalFuelEnergy);
-            EventData->SetNumberField(TEXT("fuel_energy_max"), MaxFuelEnergy);
-            EventData->SetNumberField(TEXT("fuel_percentage"), MaxFuelEnergy > 0 ? TotalFuelEnergy / MaxFuelEnergy : 0.0f);
-        }
-        
-        // Inventory/Storage
-        UFGInventoryComponent* Inventory = Vehicle->GetStorageInventory();
-        if (Inventory)
-        {
-            TArray<TSharedPtr<FJsonValue>> CargoArray;
-            int32 SlotsUsed = 0;
-            int32 TotalSlots = Inventory->GetSizeLinear();
-            float TotalWeight = 0.0f;
-            
-            for (int32 i = 0; i < TotalSlots; i++)
-            {
-                FInventoryStack Stack;
-                if (Inventory->GetStackFromIndex(i, Stack) && !Stack.Item.ItemClass.IsNull())
-                {
-                    SlotsUsed++;
-                    
-                    TSharedPtr<FJsonObject> CargoItem = MakeShareable(new FJsonObject);
-                    UFGItemDescriptor* ItemDesc = Stack.Item.ItemClass->GetDefaultObject<UFGItemDescriptor>();
-                    
-                    CargoItem->SetStringField(TEXT("item_name"), ItemDesc->GetDisplayName().ToString());
-                    CargoItem->SetNumberField(TEXT("quantity"), Stack.NumItems);
-                    
-                    float ItemWeight = ItemDesc->GetWeight() * Stack.NumItems;
-                    CargoItem->SetNumberField(TEXT("weight"), ItemWeight);
-                    TotalWeight += ItemWeight;
-                    
-                    CargoArray.Add(MakeShareable(new FJsonValueObject(CargoItem)));
-                }
-            }
-            
-            EventData->SetArrayField(TEXT("cargo"), CargoArray);
-            EventData->SetNumberField(TEXT("cargo_slots_used"), SlotsUsed);
-            EventData->SetNumberField(TEXT("cargo_slots_total"), TotalSlots);
-            EventData->SetNumberField(TEXT("cargo_utilization"), TotalSlots > 0 ? (float)SlotsUsed / TotalSlots : 0.0f);
-            EventData->SetNumberField(TEXT("cargo_weight"), TotalWeight);
-        }
-        
-        // Vehicle-specific data
-        if (VehicleType == TEXT("CyberWagon"))
-        {
-            EventData->SetStringField(TEXT("power_type"), TEXT("Electric"));
-        }
-        else
-        {
-            EventData->SetStringField(TEXT("power_type"), TEXT("Fuel"));
-        }
-        
-        EventData->SetNumberField(TEXT("max_speed"), Vehicle->GetMaxSpeed());
-        
-        // Autopilot data for automated vehicles
-        if (bIsAutomated)
+        const bool bOutOfTime = FPlatformTime::Seconds() >= Deadline;
+        if (!bOutOfTime)
         {
-            AFGBuildableDockingStation* TargetStation = Vehicle->GetTargetNodeLinkedDockingStation();
-            if (TargetStation)
-            {
-                EventData->SetStringField(TEXT("target_station"), TargetStation->GetName());
-                
-                FVector TargetLocation = TargetStation->GetActorLocation();
-                float DistanceToTarget = FVector::Dist(Location, TargetLocation);
-                EventData->SetNumberField(TEXT("distance_to_target"), DistanceToTarget);
-            }
+            Sweep.bActive = !AdvanceSweep((ESplunkSweep)Index, Sweep, *Registry, Deadline);
         }
-        
-        EventObject->SetObjectField(TEXT("event"), EventData);
-        AddEventToBuffer(EventObject);
+    }
+    NextSweepIndex = (NextSweepIndex + 1) % NumSweeps;
+
+    // Checked after the loop: a slice may start another sweep (the generators start Circuits)
+    bool bAnyActive = false;
+    for (const FCollectorSweep& Sweep : Sweeps)
+    {
+        bAnyActive |= Sweep.bActive;
+    }
+    if (!bAnyActive)
+    {
+        SetActorTickEnabled(false);
     }
 }
 
-void ASplunkExporter::CollectTrainData()
+bool ASplunkExporter::AdvanceSweep(ESplunkSweep Kind, FCollectorSweep& Sweep, const USplunkBuildableRegistry& Registry, double Deadline)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    using SplunkExporter::AdvanceCursor;
+    SPLUNK_SCOPE("Splunk::SweepSlice", STAT_SplunkSweepSlice);
+    FSplunkScopedTiming Timing(SweepTimings[(int32)Kind]);
+    const int64 Time = Sweep.Time;
+    const bool bKeyframe = Sweep.bKeyframe;
 
-    for (TActorIterator<AFGTrain> ActorItr(World); ActorItr; ++ActorItr)
+    switch (Kind)
     {
-        AFGTrain* Train = *ActorItr;
-        if (!Train || !Train->IsValidLowLevel()) continue;
-
-        TSharedPtr<FJsonObject> EventObject = CreateBaseEvent(TEXT("satisfactory:vehicle:train"));
-        TSharedPtr<FJsonObject> EventData = MakeShareable(new FJsonObject);
-        
-        EventData->SetStringField(TEXT("vehicle_type"), TEXT("Train"));
-        EventData->SetStringField(TEXT("train_id"), Train->GetName());
-        EventData->SetNumberField(TEXT("speed"), Train->GetVelocity().Size());
-        EventData->SetBoolField(TEXT("is_player_driven"), Train->IsPlayerDriven());
-        
-        // Get all rolling stock
-        TArray<AFGRailroadVehicle*> RollingStock = Train->GetConsist();
-        EventData->SetNumberField(TEXT("car_count"), RollingStock.Num());
-        
-        TArray<TSharedPtr<FJsonValue>> CarsArray;
-        float TotalPowerConsumption = 0.0f;
-        
-        for (int32 i = 0; i < RollingStock.Num(); i++)
-        {
-            AFGRailroadVehicle* Car = RollingStock[i];
-            if (!Car) continue;
-            
-            TSharedPtr<FJsonObject> CarData = MakeShareable(new FJsonObject);
-            
-            FVector CarLocation = Car->GetActorLocation();
-            CarData->SetNumberField(TEXT("car_index"), i);
-            CarData->SetStringField(TEXT("car_id"), Car->GetName());
-            CarData->SetNumberField(TEXT("location_x"), CarLocation.X);
-            CarData->SetNumberField(TEXT("location_y"), CarLocation.Y);
-            CarData->SetNumberField(TEXT("location_z"), CarLocation.Z);
-            
-            // Check if it's a locomotive
-            AFGLocomotive* Locomotive = Cast<AFGLocomotive>(Car);
-            if (Locomotive)
-            {
-                CarData->SetStringField(TEXT("car_type"), TEXT("Locomotive"));
-                CarData->SetNumberField(TEXT("power_consumption"), Locomotive->GetPowerConsumption());
-                TotalPowerConsumption += Locomotive->GetPowerConsumption();
-                
-                // Fuel status
-                UFGInventoryComponent* FuelInventory = Locomotive->GetFuelInventory();
-                if (FuelInventory)
-                {
-                    int32 FuelStacks = 0;
-                    int32 MaxFuelStacks = FuelInventory->GetSizeLinear();
-                    
-                    for (int32 j = 0; j < MaxFuelStacks; j++)
-                    {
-                        FInventoryStack Stack;
-                        if (FuelInventory->GetStackFromIndex(j, Stack) && !Stack.Item.ItemClass.IsNull())
-                        {
-                            FuelStacks++;
-                        }
-                    }
-                    
-                    float FuelPercentage = MaxFuelStacks > 0 ? (float)FuelStacks / MaxFuelStacks : 0.0f;
-                    CarData->SetNumberField(TEXT("fuel_percentage"), FuelPercentage);
-                }
-            }
-            else
+        case ESplunkSweep::Manufacturers:
+            return AdvanceCursor(Registry.GetManufacturers(), Sweep.Cursor, Deadline,
+                [this, Time, bKeyframe](AFGBuildableManufacturer* Actor, int32 Slot) { WriteManufacturerEvent(Actor, Slot, Time, bKeyframe); });
+        case ESplunkSweep::Extractors:
+            return AdvanceCursor(Registry.GetExtractors(), Sweep.Cursor, Deadline,
+                [this, Time, bKeyframe](AFGBuildableResourceExtractor* Actor, int32 Slot) { WriteExtractorEvent(Actor, Slot, Time, bKeyframe); });
+        case ESplunkSweep::Generators:
+            // Circuits are few, so they are written whole with the first slice
+            if (Sweep.Cursor == 0)
             {
-                // Freight car
-                AFGFreightWagon* FreightCar = Cast<AFGFreightWagon>(Car);
-                if (FreightCar)
-                {
-                    CarData->SetStringField(TEXT("car_type"), TEXT("Freight"));
-                    
-                    UFGInventoryComponent* CargoInventory = FreightCar->GetStorageInventory();
-                    if (CargoInventory)
-                    {
-                        TArray<TSharedPtr<FJsonValue>> CargoArray;
-                        int32 SlotsUsed = 0;
-                        int32 TotalSlots = CargoInventory->GetSizeLinear();
-                        
-                        for (int32 j = 0; j < TotalSlots; j++)
-                        {
-                            FInventoryStack Stack;
-                            if (CargoInventory->GetStackFromIndex(j, Stack) && !Stack.Item.ItemClass.IsNull())
-                            {
-                                SlotsUsed++;
-                                
-                                TSharedPtr<FJsonObject> CargoItem = MakeShareable(new FJsonObject);
-                                UFGItemDescriptor* ItemDesc = Stack.Item.ItemClass->GetDefaultObject<UFGItemDescriptor>();
-                                CargoItem->SetStringField(TEXT("item_name"), ItemDesc->GetDisplayName().ToString());
-                                CargoItem->SetNumberField(TEXT("quantity"), Stack.NumItems);
-                                
-                                CargoArray.Add(MakeShareable(new FJsonValueObject(CargoItem)));
-                            }
-                        }
-                        
-                        CarData->SetArrayField(TEXT("cargo"), CargoArray);
-                        CarData->SetNumberField(TEXT("cargo_utilization"), TotalSlots > 0 ? (float)SlotsUsed / TotalSlots : 0.0f);
-                    }
-                }
+                WriteCircuitEvents(Time);
             }
-            
-            CarsArray.Add(MakeShareable(new FJsonValueObject(CarData)));
-        }
-        
-        EventData->SetArrayField(TEXT("cars"), CarsArray);
-        EventData->SetNumberField(TEXT("total_power_consumption"), TotalPowerConsumption);
-        
-        // Timetable information
-        AFGRailroadTimeTable* TimeTable = Train->GetTimeTable();
-        if (TimeTable)
+            return AdvanceCursor(Registry.GetGenerators(), Sweep.Cursor, Deadline,
+                [this, Time, bKeyframe](AFGBuildablePowerGenerator* Actor, int32 Slot) { WriteGeneratorEvent(Actor, Slot, Time, bKeyframe); });
+        case ESplunkSweep::Vehicles:
+            return AdvanceCursor(Registry.GetVehicles(), Sweep.Cursor, Deadline,
+                [this, Time](AFGWheeledVehicle* Actor, int32) { WriteVehicleEvent(Actor, Time); });
+        case ESplunkSweep::Trains:
+            return AdvanceCursor(Registry.GetTrains(), Sweep.Cursor, Deadline,
+                [this, Time](AFGTrain* Actor, int32) { WriteTrainEvent(Actor, Time); });
+        case ESplunkSweep::Players:
+            return AdvanceCursor(Registry.GetPlayers(), Sweep.Cursor, Deadline,
+                [this, Time](AFGCharacterPlayer* Actor, int32) { WritePlayerEvent(Actor, Time); });
+        case ESplunkSweep::Layout:
         {
-            TArray<AFGTrainStationIdentifier*> Stations = TimeTable->GetStations();
-            EventData->SetNumberField(TEXT("timetable_stations"), Stations.Num());
-            
-            int32 CurrentStop = TimeTable->GetCurrentStop();
-            EventData->SetNumberField(TEXT("current_stop_index"), CurrentStop);
-            
-            if (CurrentStop >= 0 && CurrentStop < Stations.Num())
+            // The list is swap-removed on dismantle, so a building dismantled mid-snapshot may shift another past the cursor
+            const bool bDone = AdvanceCursor(Registry.GetBuildables(), Sweep.Cursor, Deadline,
+                [this, &Sweep](AFGBuildable* Actor, int32) { WriteLayoutBuilding(Actor, Sweep); });
+            if (bDone)
             {
-                AFGTrainStationIdentifier* CurrentStation = Stations[CurrentStop];
-                if (CurrentStation)
-                {
-                    EventData->SetStringField(TEXT("current_station"), CurrentStation->GetStationName().ToString());
-                }
+                EndLayoutPage(Sweep, true);
             }
+            return bDone;
         }
-        
-        EventObject->SetObjectField(TEXT("event"), EventData);
-        AddEventToBuffer(EventObject);
+        case ESplunkSweep::Circuits:
+            return Circuits.AdvanceRebuild(GetWorld(), Registry, *Names, Sweep.Cursor, Deadline);
+        default:
+            return true;
     }
 }
 
-void ASplunkExporter::CollectPlayerMovementSystems()
+int64 ASplunkExporter::GetEventTime()
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    return FDateTime::Now().ToUnixTimestamp();
+}
+
+void ASplunkExporter::CollectProductionData()
+{
+    BeginSweep(ESplunkSweep::Manufacturers);
+    BeginSweep(ESplunkSweep::Extractors);
+}
 
-    for (TActorIterator<AFGCharacterPlayer> ActorItr(World); ActorItr; ++ActorItr)
+void ASplunkExporter::WriteManufacturerEvent(AFGBuildableManufacturer* Manufacturer, int32 Slot, int64 Time, bool bKeyframe)
+{
+    const int32 Kind = (int32)ESplunkMachineKind::Manufacturer;
+    FSplunkMachineReading Reading;
+    SplunkExporter::ReadMachine(Manufacturer, *Names, Reading);
+    MachineStores[Kind].Write(Slot, Reading);
+
+    // Recipe names resolved once per recipe, re-resolved when the machine switches recipe
+    const FSplunkRecipeNames* Recipe = Names->GetRecipeNames(Manufacturer, Manufacturer->GetCurrentRecipe());
+    if (FSplunkEventEncoders::WriteManufacturerEvent(EventWriter, MachineStores[Kind], Slot, Recipe, bDeltaMode ? &MachineDeltas[Kind] : nullptr, Time, bKeyframe))
     {
-        AFGCharacterPlayer* Player = *ActorItr;
-        if (!Player || !Player->IsValidLowLevel()) continue;
+        CommitEvent(ESplunkLane::Events);
+    }
+}
 
-        TSharedPtr<FJsonObject> EventObject = CreateBaseEvent(TEXT("satisfactory:player:movement"));
-        TSharedPtr<FJsonObject> EventData = MakeShareable(new FJsonObject);
-        
-        EventData->SetStringField(TEXT("player_name"), Player->GetName());
-        
-        // Position
-        FVector Location = Player->GetActorLocation();
-        FVector Velocity = Player->GetVelocity();
-        
-        EventData->SetNumberField(TEXT("location_x"), Location.X);
-        EventData->SetNumberField(TEXT("location_y"), Location.Y);
-        EventData->SetNumberField(TEXT("location_z"), Location.Z);
-        EventData->SetNumberField(TEXT("speed"), Velocity.Size());
-        
-        // Movement state
-        UCharacterMovementComponent* Movement = Player->GetCharacterMovement();
-        if (Movement)
-        {
-            bool bIsFlying = Movement->IsFlying();
-            bool bIsFalling = Movement->IsFalling();
-            bool bIsWalking = Movement->IsWalking();
-            
-            EventData->SetBoolField(TEXT("is_flying"), bIsFlying);
-            EventData->SetBoolField(TEXT("is_falling"), bIsFalling);
-            EventData->SetBoolField(TEXT("is_walking"), bIsWalking);
-        }
-        
-        // Jetpack status
-        UFGJetPack* JetPack = Player->GetJetPack();
-        if (JetPack)
-        {
-            EventData->SetBoolField(TEXT("has_jetpack"), true);
-            EventData->SetBoolField(TEXT("jetpack_active"), JetPack->IsActive());
-            EventData->SetNumberField(TEXT("jetpack_fuel"), JetPack->GetCurrentFuel());
-            EventData->SetNumberField(TEXT("jetpack_fuel_max"), JetPack->GetMaxFuel());
-        }
-        else
-        {
-            EventData->SetBoolField(TEXT("has_jetpack"), false);
-        }
-        
-        // Check if in vehicle
-        APawn* VehiclePawn = Player->GetVehicle();
-        if (VehiclePawn)
+void ASplunkExporter::WriteExtractorEvent(AFGBuildableResourceExtractor* Extractor, int32 Slot, int64 Time, bool bKeyframe)
+{
+    const int32 Kind = (int32)ESplunkMachineKind::Extractor;
+    FSplunkMachineReading Reading;
+    SplunkExporter::ReadMachine(Extractor, *Names, Reading);
+    MachineStores[Kind].Write(Slot, Reading);
+
+    if (FSplunkEventEncoders::WriteExtractorEvent(EventWriter, MachineStores[Kind], Slot, bDeltaMode ? &MachineDeltas[Kind] : nullptr, Time, bKeyframe))
+    {
+        CommitEvent(ESplunkLane::Events);
+    }
+}
+
+void ASplunkExporter::CollectPowerData()
+{
+    // Circuit events go out with the sweep's first slice
+    BeginSweep(ESplunkSweep::Generators);
+}
+
+void ASplunkExporter::WriteCircuitEvents(int64 Time)
+{
+    if (!Names) return;
+
+    RefreshCircuits();
+    Circuits.Read(CircuitReadings);
+    for (const FSplunkCircuitReading& Reading : CircuitReadings)
+    {
+        EventWriter.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:power:circuit"));
+        EventWriter.BeginObject(SPLUNK_HEC_KEY("event"));
+        EventWriter.WriteName(SPLUNK_HEC_KEY("circuit_id"), Reading.NameId);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("power_production"), Reading.Production);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("power_consumption"), Reading.Consumption);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("power_capacity"), Reading.Capacity);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("max_power_consumption"), Reading.MaxConsumption);
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("fuse_triggered"), Reading.bFuseTriggered);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("generators"), Reading.Generators);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("consumers"), Reading.Consumers);
+        if (Reading.bHasBatteries)
         {
-            EventData->SetBoolField(TEXT("in_vehicle"), true);
-            EventData->SetStringField(TEXT("vehicle_name"), VehiclePawn->GetName());
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("battery_stored"), Reading.BatteryStored);
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("battery_capacity"), Reading.BatteryCapacity);
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("battery_input"), Reading.BatteryInput);
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("time_to_batteries_empty"), Reading.TimeToBatteriesEmpty);
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("time_to_batteries_full"), Reading.TimeToBatteriesFull);
         }
-        else
+        EventWriter.EndObject();
+        CommitEvent(ESplunkLane::Power);
+    }
+}
+
+void ASplunkExporter::RefreshCircuits()
+{
+    // Membership walks every building, so it is a sweep of its own under the frame budget, not part of this pass
+    if (Circuits.IsStale() && !Sweeps[(int32)ESplunkSweep::Circuits].bActive)
+    {
+        BeginSweep(ESplunkSweep::Circuits);
+    }
+}
+
+void ASplunkExporter::CheckPowerAlerts()
+{
+    // Light task: reads the circuits the heavy power slot last cached and never rebuilds them itself
+    Circuits.Read(CircuitReadings);
+    PendingAlerts.Reset();
+    PowerAlerts.Detect(CircuitReadings, PendingAlerts);
+    if (PendingAlerts.Num() == 0) return;
+
+    const int64 Time = GetEventTime();
+    for (const FSplunkPowerAlertEvent& Alert : PendingAlerts)
+    {
+        const FSplunkCircuitReading& Reading = Alert.Reading;
+        AlertWriter.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:power:alert"));
+        AlertWriter.BeginObject(SPLUNK_HEC_KEY("event"));
+        AlertWriter.WriteString(SPLUNK_HEC_KEY("alert"), FSplunkPowerAlerts::ToString(Alert.Alert));
+        AlertWriter.WriteString(SPLUNK_HEC_KEY("circuit_id"), FString::FromInt(Reading.CircuitId));
+        AlertWriter.WriteNumber(SPLUNK_HEC_KEY("power_production"), Reading.Production);
+        AlertWriter.WriteNumber(SPLUNK_HEC_KEY("power_consumption"), Reading.Consumption);
+        AlertWriter.WriteNumber(SPLUNK_HEC_KEY("power_capacity"), Reading.Capacity);
+        if (Reading.bHasBatteries)
         {
-            EventData->SetBoolField(TEXT("in_vehicle"), false);
+            AlertWriter.WriteNumber(SPLUNK_HEC_KEY("battery_stored"), Reading.BatteryStored);
+            AlertWriter.WriteNumber(SPLUNK_HEC_KEY("battery_input"), Reading.BatteryInput);
+            AlertWriter.WriteNumber(SPLUNK_HEC_KEY("time_to_batteries_empty"), Reading.TimeToBatteriesEmpty);
         }
-        
-        EventObject->SetObjectField(TEXT("event"), EventData);
-        AddEventToBuffer(EventObject);
+        AlertWriter.EndObject();
+        AlertWriter.EndEvent();
+
+        UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkExporter: Power alert %s on circuit %d"),
+            FSplunkPowerAlerts::ToString(Alert.Alert), Reading.CircuitId);
     }
+    PowerAlertsTotal += PendingAlerts.Num();
+
+    // Not gzipped and not queued behind the buffer: a few hundred bytes that must arrive now.
+    // If Splunk is down DispatchRequest spools it like any other batch.
+    DispatchRequest(AlertWriter.ReleaseBuffer(), false);
 }
 
-void ASplunkExporter::CollectFactoryLayoutData()
+void ASplunkExporter::WriteGeneratorEvent(AFGBuildablePowerGenerator* Generator, int32 Slot, int64 Time, bool bKeyframe)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    const int32 Kind = (int32)ESplunkMachineKind::Generator;
+    FSplunkMachineReading Reading;
+    SplunkExporter::ReadMachine(Generator, *Names, Reading);
+    MachineStores[Kind].Write(Slot, Reading);
 
-    TSharedPtr<FJsonObject> LayoutEvent = CreateBaseEvent(TEXT("satisfactory:factory:layout"));
-    TSharedPtr<FJsonObject> EventData = MakeShareable(new FJsonObject);
+    if (FSplunkEventEncoders::WriteGeneratorEvent(EventWriter, MachineStores[Kind], Slot, bDeltaMode ? &MachineDeltas[Kind] : nullptr, Time, bKeyframe))
+    {
+        CommitEvent(ESplunkLane::Events);
+    }
+}
 
-    EventData->SetStringField(TEXT("event_type"), TEXT("factory_layout"));
+void ASplunkExporter::CollectAllVehicleData()
+{
+    BeginSweep(ESplunkSweep::Vehicles);
+    BeginSweep(ESplunkSweep::Trains);
+}
 
-    TArray<TSharedPtr<FJsonValue>> BuildingsArray;
+void ASplunkExporter::WriteVehicleEvent(AFGWheeledVehicle* Vehicle, int64 Time)
+{
+    SplunkExporter::ReadVehicle(Vehicle, *Names, VehicleReading);
+    FSplunkEventEncoders::WriteVehicleEvent(EventWriter, VehicleReading, Time);
+    CommitEvent(ESplunkLane::Events);
+}
 
-    for (TActorIterator<AFGBuildable> ActorItr(World); ActorItr; ++ActorItr)
-    {
-        AFGBuildable* Building = *ActorItr;
-        if (!Building) continue;
+void ASplunkExporter::WriteTrainEvent(AFGTrain* Train, int64 Time)
+{
+    SplunkExporter::ReadTrain(Train, *Names, TrainReading);
+    FSplunkEventEncoders::WriteTrainEvent(EventWriter, TrainReading, Time);
+    CommitEvent(ESplunkLane::Events);
+}
 
-        TSharedPtr<FJsonObject> BuildingData = MakeShareable(new FJsonObject);
-        BuildingData->SetStringField(TEXT("building_type"), Building->GetClass()->GetName());
-        BuildingData->SetStringField(TEXT("building_id"), Building->GetName());
+void ASplunkExporter::CollectPlayerMovementSystems()
+{
+    BeginSweep(ESplunkSweep::Players);
+}
 
-        FVector Location = Building->GetActorLocation();
-        BuildingData->SetNumberField(TEXT("x"), Location.X);
-        BuildingData->SetNumberField(TEXT("y"), Location.Y);
-        BuildingData->SetNumberField(TEXT("z"), Location.Z);
+void ASplunkExporter::WritePlayerEvent(AFGCharacterPlayer* Player, int64 Time)
+{
+    EventWriter.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:player:movement"));
+    EventWriter.BeginObject(SPLUNK_HEC_KEY("event"));
+    
+    EventWriter.WriteName(SPLUNK_HEC_KEY("player_name"), Names->GetActorName(Player));
+    
+    // Position
+    FVector Location = Player->GetActorLocation();
+    FVector Velocity = Player->GetVelocity();
+    
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("location_x"), Location.X);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("location_y"), Location.Y);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("location_z"), Location.Z);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("speed"), Velocity.Size());
+    
+    // Movement state
+    UCharacterMovementComponent* Movement = Player->GetCharacterMovement();
+    if (Movement)
+    {
+        bool bIsFlying = Movement->IsFlying();
+        bool bIsFalling = Movement->IsFalling();
+        bool bIsWalking = Movement->IsWalking();
+        
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("is_flying"), bIsFlying);
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("is_falling"), bIsFalling);
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("is_walking"), bIsWalking);
+    }
+    
+    // Jetpack status
+    UFGJetPack* JetPack = Player->GetJetPack();
+    if (JetPack)
+    {
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("has_jetpack"), true);
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("jetpack_active"), JetPack->IsActive());
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("jetpack_fuel"), JetPack->GetCurrentFuel());
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("jetpack_fuel_max"), JetPack->GetMaxFuel());
+    }
+    else
+    {
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("has_jetpack"), false);
+    }
+    
+    // Check if in vehicle
+    APawn* VehiclePawn = Player->GetVehicle();
+    if (VehiclePawn)
+    {
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("in_vehicle"), true);
+        EventWriter.WriteName(SPLUNK_HEC_KEY("vehicle_name"), Names->GetActorName(VehiclePawn));
+    }
+    else
+    {
+        EventWriter.WriteBool(SPLUNK_HEC_KEY("in_vehicle"), false);
+    }
+    
+    EventWriter.EndObject();
+    CommitEvent(ESplunkLane::Events);
+}
 
-        FRotator Rotation = Building->GetActorRotation();
-        BuildingData->SetNumberField(TEXT("rotation"), Rotation.Yaw);
+void ASplunkExporter::CollectFactoryLayoutData()
+{
+    BeginSweep(ESplunkSweep::Layout);
+}
 
-        BuildingsArray.Add(MakeShareable(new FJsonValueObject(BuildingData)));
+void ASplunkExporter::WriteLayoutBuilding(AFGBuildable* Building, FCollectorSweep& Sweep)
+{
+    if (Sweep.PageFill == 0)
+    {
+        BeginLayoutPage(Sweep);
     }
 
-    EventData->SetArrayField(TEXT("buildings"), BuildingsArray);
-    LayoutEvent->SetObjectField(TEXT("event"), EventData);
+    LayoutWriter.BeginObject();
+    LayoutWriter.WriteName(SPLUNK_HEC_KEY("building_type"), Names->GetClassName(Building->GetClass()));
+    LayoutWriter.WriteName(SPLUNK_HEC_KEY("building_id"), Names->GetActorName(Building));
 
-    SendLayoutDataToSplunk(LayoutEvent);
-}
+    const FVector Location = Building->GetActorLocation();
+    LayoutWriter.WriteNumber(SPLUNK_HEC_KEY("x"), Location.X);
+    LayoutWriter.WriteNumber(SPLUNK_HEC_KEY("y"), Location.Y);
+    LayoutWriter.WriteNumber(SPLUNK_HEC_KEY("z"), Location.Z);
+    LayoutWriter.WriteNumber(SPLUNK_HEC_KEY("rotation"), Building->GetActorRotation().Yaw);
+    LayoutWriter.EndObject();
 
-// ===== METRICS MODE - PER-TYPE COLLECTORS =====
+    if (++Sweep.PageFill >= FMath::Clamp(LayoutPageSize, 50, 2000))
+    {
+        EndLayoutPage(Sweep, false);
+    }
+}
 
-TSharedPtr<FJsonObject> ASplunkExporter::CreateMetricsEvent()
+void ASplunkExporter::OnBuildableChanged(AFGBuildable* Building, bool bAdded)
 {
-    TSharedPtr<FJsonObject> Event = MakeShareable(new FJsonObject);
-    Event->SetStringField(TEXT("time"), FString::Printf(TEXT("%.0f"), FDateTime::Now().ToUnixTimestamp()));
-    Event->SetStringField(TEXT("event"), TEXT("metric"));
-    Event->SetStringField(TEXT("source"), TEXT("satisfactory-mod"));
-    Event->SetStringField(TEXT("sourcetype"), TEXT("satisfactory:metrics"));
-    return Event;
+    if (!bIsCollecting || IsMetricsModeActive() || !Names) return;
+
+    EventWriter.BeginEvent(GetEventTime(), SPLUNK_HEC_STRING("satisfactory:factory:layout:change"));
+    EventWriter.BeginObject(SPLUNK_HEC_KEY("event"));
+    EventWriter.WriteString(SPLUNK_HEC_KEY("change"), bAdded ? SPLUNK_HEC_STRING("built") : SPLUNK_HEC_STRING("dismantled"));
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("seq"), LayoutChangeSeq++);
+    EventWriter.WriteName(SPLUNK_HEC_KEY("building_id"), Names->GetActorName(Building));
+    if (bAdded)
+    {
+        // Same fields as a snapshot entry, so replay is an upsert by building_id
+        EventWriter.WriteName(SPLUNK_HEC_KEY("building_type"), Names->GetClassName(Building->GetClass()));
+        const FVector Location = Building->GetActorLocation();
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("x"), Location.X);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("y"), Location.Y);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("z"), Location.Z);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("rotation"), Building->GetActorRotation().Yaw);
+    }
+    EventWriter.EndObject();
+    CommitEvent(ESplunkLane::Bulk);
 }
 
-void ASplunkExporter::CollectPowerMetrics()
+void ASplunkExporter::BeginLayoutPage(FCollectorSweep& Sweep)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
-
-    float TotalConsumption = 0.0f;
-    float TotalProduction = 0.0f;
-    int32 GeneratorCount = 0;
-
-    for (TActorIterator<AFGBuildablePowerGenerator> It(World); It; ++It)
-        if (It->IsValidLowLevel()) { GeneratorCount++; TotalProduction += It->GetPowerProduction(); }
-
-    for (TActorIterator<AFGBuildableManufacturer> It(World); It; ++It)
-        if (It->IsValidLowLevel()) TotalConsumption += It->GetPowerConsumption();
-
-    for (TActorIterator<AFGBuildableResourceExtractor> It(World); It; ++It)
-        if (It->IsValidLowLevel()) TotalConsumption += It->GetPowerConsumption();
-
-    TSharedPtr<FJsonObject> Event = CreateMetricsEvent();
-    TSharedPtr<FJsonObject> Fields = MakeShareable(new FJsonObject);
-    Fields->SetNumberField(TEXT("metric_name:factory.power.consumption"), TotalConsumption);
-    Fields->SetNumberField(TEXT("metric_name:factory.power.production"), TotalProduction);
-    Fields->SetNumberField(TEXT("metric_name:factory.power.net"),        TotalProduction - TotalConsumption);
-    Fields->SetNumberField(TEXT("metric_name:factory.machines.generators"), GeneratorCount);
-    Event->SetObjectField(TEXT("fields"), Fields);
-    AddEventToBuffer(Event);
-    EventsInBuffer = DataBuffer.Num();
+    LayoutWriter.BeginEvent(Sweep.Time, SPLUNK_HEC_STRING("satisfactory:factory:layout"));
+    LayoutWriter.BeginObject(SPLUNK_HEC_KEY("event"));
+    LayoutWriter.WriteString(SPLUNK_HEC_KEY("event_type"), SPLUNK_HEC_STRING("factory_layout"));
+    LayoutWriter.WriteInt(SPLUNK_HEC_KEY("snapshot_id"), Sweep.Time);
+    LayoutWriter.WriteInt(SPLUNK_HEC_KEY("page"), Sweep.Page);
+    LayoutWriter.BeginArray(SPLUNK_HEC_KEY("buildings"));
 }
 
-void ASplunkExporter::CollectProductionMetrics()
+void ASplunkExporter::EndLayoutPage(FCollectorSweep& Sweep, bool bLastPage)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    SPLUNK_SCOPE("Splunk::LayoutPage", STAT_SplunkLayout);
 
-    int32 ManufacturerCount = 0;
-    int32 ExtractorCount = 0;
-    float TotalEfficiency = 0.0f;
-    int32 ProducingCount = 0;
+    if (Sweep.PageFill == 0)
+    {
+        if (!bLastPage) return;
+        // The snapshot ended on a page boundary (or is empty): close it with an empty last page
+        BeginLayoutPage(Sweep);
+    }
 
-    for (TActorIterator<AFGBuildableManufacturer> It(World); It; ++It)
+    LayoutWriter.EndArray();
+    LayoutWriter.WriteInt(SPLUNK_HEC_KEY("building_count"), Sweep.PageFill);
+    LayoutWriter.WriteBool(SPLUNK_HEC_KEY("last_page"), bLastPage);
+    if (bLastPage)
     {
-        if (!It->IsValidLowLevel()) continue;
-        ManufacturerCount++;
-        float Eff = It->GetProductionEfficiency();
-        if (Eff > 0.0f) { TotalEfficiency += Eff; ProducingCount++; }
+        LayoutWriter.WriteInt(SPLUNK_HEC_KEY("page_count"), Sweep.Page + 1);
+        bLayoutBaselineSent = true;
     }
-    for (TActorIterator<AFGBuildableResourceExtractor> It(World); It; ++It)
+    LayoutWriter.EndObject();
+    LayoutWriter.EndEvent();
+
+    if (Pipeline)
     {
-        if (!It->IsValidLowLevel()) continue;
-        ExtractorCount++;
-        float Eff = It->GetProductionEfficiency();
-        if (Eff > 0.0f) { TotalEfficiency += Eff; ProducingCount++; }
+        Pipeline->Submit(LayoutWriter.GetSamples(), ESplunkLane::Bulk, false);
     }
+    LayoutWriter.Reset();
 
-    TSharedPtr<FJsonObject> Event = CreateMetricsEvent();
-    TSharedPtr<FJsonObject> Fields = MakeShareable(new FJsonObject);
-    Fields->SetNumberField(TEXT("metric_name:factory.machines.manufacturers"), ManufacturerCount);
-    Fields->SetNumberField(TEXT("metric_name:factory.machines.extractors"),   ExtractorCount);
-    Fields->SetNumberField(TEXT("metric_name:factory.efficiency.average"),    ProducingCount > 0 ? TotalEfficiency / ProducingCount : 0.0f);
-    Event->SetObjectField(TEXT("fields"), Fields);
-    AddEventToBuffer(Event);
-    EventsInBuffer = DataBuffer.Num();
+    Sweep.Page++;
+    Sweep.PageFill = 0;
 }
 
-void ASplunkExporter::CollectVehicleMetrics()
+// ===== METRICS MODE =====
+
+void ASplunkExporter::CollectMetrics(ESplunkMetrics Kind)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
-
-    int32 WheeledCount = 0;
-    int32 TrainCount = 0;
-    for (TActorIterator<AFGWheeledVehicle> It(World); It; ++It) if (It->IsValidLowLevel()) WheeledCount++;
-    for (TActorIterator<AFGTrain>          It(World); It; ++It) if (It->IsValidLowLevel()) TrainCount++;
-
-    TSharedPtr<FJsonObject> Event = CreateMetricsEvent();
-    TSharedPtr<FJsonObject> Fields = MakeShareable(new FJsonObject);
-    Fields->SetNumberField(TEXT("metric_name:factory.vehicles.wheeled"), WheeledCount);
-    Fields->SetNumberField(TEXT("metric_name:factory.vehicles.trains"),  TrainCount);
-    Event->SetObjectField(TEXT("fields"), Fields);
-    AddEventToBuffer(Event);
-    EventsInBuffer = DataBuffer.Num();
+    if (!bIsCollecting) return;
+    if (!ClaimCollectorFrame())
+    {
+        GetWorldTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &ASplunkExporter::CollectMetrics, Kind));
+        return;
+    }
+
+    FSplunkScopedTiming Timing(MetricsPassTiming);
+
+    USplunkBuildableRegistry* Registry = USplunkBuildableRegistry::Get(GetWorld());
+    if (!Registry) return;
+
+    const bool bPower      = Kind == ESplunkMetrics::Power;
+    const bool bProduction = Kind == ESplunkMetrics::Production;
+    const bool bCircuits   = bPower && bDimensionedMetrics;
+    const bool bGroups     = bProduction && bDimensionedMetrics;
+
+    // Only the groups this pass refills are reset: a reset forgets which values had a series of their own
+    FMetricsTotals Totals;
+    if (bPower)
+    {
+        CircuitMetrics.Reset(MaxSeriesPerDimension);
+    }
+    if (bProduction)
+    {
+        ClassMetrics.Reset(MaxSeriesPerDimension);
+        ResourceMetrics.Reset(MaxSeriesPerDimension);
+    }
+
+    // Power comes from the circuits' own totals, O(circuits); production needs one pass per machine list
+    {
+        SPLUNK_SCOPE("Splunk::MetricsRead", STAT_SplunkMetricsRead);
+
+        if (bPower)
+        {
+            RefreshCircuits();
+            Circuits.Read(CircuitReadings);
+            // Not GetGenerators().Num(): the list still holds a dismantled generator's stale handle until its removal arrives
+            for (const auto& It : Registry->GetGenerators()) if (It.IsValid()) Totals.GeneratorCount++;
+            for (const FSplunkCircuitReading& Reading : CircuitReadings)
+            {
+                Totals.PowerProduction  += Reading.Production;
+                Totals.PowerConsumption += Reading.Consumption;
+                Totals.PowerCapacity    += Reading.Capacity;
+                Totals.BatteryStored    += Reading.BatteryStored;
+                Totals.BatteryCapacity  += Reading.BatteryCapacity;
+                Totals.FusesTriggered   += Reading.bFuseTriggered ? 1 : 0;
+
+                if (bCircuits)
+                {
+                    CircuitMetrics.FindOrAdd(Reading.NameId).Add(Reading);
+                }
+            }
+        }
+
+        // Readings go into the machine stores' columns; totals and groups are summed from there afterwards
+        if (bProduction)
+        {
+            FSplunkMachineStore& Manufacturers = MachineStores[(int32)ESplunkMachineKind::Manufacturer];
+            FSplunkMachineStore& Extractors    = MachineStores[(int32)ESplunkMachineKind::Extractor];
+            SplunkExporter::ReadMachines(Registry->GetManufacturers(), *Names, Manufacturers);
+            SplunkExporter::ReadMachines(Registry->GetExtractors(), *Names, Extractors);
+
+            Totals.Manufacturers = Manufacturers.Rollup();
+            Totals.Extractors    = Extractors.Rollup();
+            if (bGroups)
+            {
+                Manufacturers.RollupGroups(ClassMetrics);
+                Extractors.RollupGroups(ResourceMetrics);
+            }
+        }
+    }
+
+    SPLUNK_SCOPE("Splunk::MetricsRecord", STAT_SplunkMetricsRecord);
+    const int64 Time = GetEventTime();
+
+    if (bPower)
+    {
+        WritePowerMetrics(Totals, Time);
+    }
+    if (bProduction)
+    {
+        WriteProductionMetrics(Totals, Time);
+    }
+
+    if (Kind == ESplunkMetrics::Vehicles)
+    {
+        int32 WheeledCount = 0;
+        int32 TrainCount = 0;
+        for (const auto& It : Registry->GetVehicles()) if (It.IsValid()) WheeledCount++;
+        for (const auto& It : Registry->GetTrains())   if (It.IsValid()) TrainCount++;
+
+        EventWriter.BeginMetricsEvent(Time);
+        EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.vehicles.wheeled"), WheeledCount);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.vehicles.trains"),  TrainCount);
+        EventWriter.EndObject();
+        CommitEvent(ESplunkLane::Metrics);
+    }
+
+    if (Kind == ESplunkMetrics::Players)
+    {
+        int32 PlayerCount = 0;
+        for (const auto& It : Registry->GetPlayers()) if (It.IsValid()) PlayerCount++;
+
+        EventWriter.BeginMetricsEvent(Time);
+        EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.players"), PlayerCount);
+        EventWriter.EndObject();
+        CommitEvent(ESplunkLane::Metrics);
+    }
 }
 
-void ASplunkExporter::CollectPlayerMetrics()
+void ASplunkExporter::WritePowerMetrics(const FMetricsTotals& Totals, int64 Time)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
-
-    int32 PlayerCount = 0;
-    for (TActorIterator<AFGCharacterPlayer> It(World); It; ++It) if (It->IsValidLowLevel()) PlayerCount++;
+    EventWriter.BeginMetricsEvent(Time);
+    EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.power.consumption"), Totals.PowerConsumption);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.power.production"), Totals.PowerProduction);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.power.net"),        Totals.PowerProduction - Totals.PowerConsumption);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.power.capacity"),   Totals.PowerCapacity);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.power.battery.stored"),   Totals.BatteryStored);
+    EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.power.battery.capacity"), Totals.BatteryCapacity);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.power.fuses_triggered"), Totals.FusesTriggered);
+    EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.machines.generators"), Totals.GeneratorCount);
+    EventWriter.EndObject();
+    CommitEvent(ESplunkLane::Power);
+
+    // One multi-metric event per circuit, with circuit_id as the dimension
+    CircuitMetrics.ForEach([this, Time](int32 CircuitName, const FCircuitMetrics& Circuit)
+    {
+        EventWriter.BeginMetricsEvent(Time);
+        EventWriter.BeginObject(SPLUNK_HEC_KEY("fields"));
+        FSplunkEventEncoders::WriteDimension(EventWriter, SPLUNK_HEC_KEY("circuit_id"), CircuitName);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.power.consumption"), Circuit.Consumption);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.power.production"), Circuit.Production);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.power.net"),        Circuit.Production - Circuit.Consumption);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.power.capacity"),   Circuit.Capacity);
+        EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.power.max_consumption"), Circuit.MaxConsumption);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.circuit.fuse_triggered"),      Circuit.FusesTriggered);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.circuit.generators"),          Circuit.Generators);
+        EventWriter.WriteInt(SPLUNK_HEC_KEY("metric_name:factory.circuit.consumers"),           Circuit.Consumers);
+        if (Circuit.BatteryCapacity > 0.0f)
+        {
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.battery.stored"),   Circuit.BatteryStored);
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.battery.capacity"), Circuit.BatteryCapacity);
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.battery.percent"),  Circuit.BatteryStored / Circuit.BatteryCapacity * 100.0f);
+            EventWriter.WriteNumber(SPLUNK_HEC_KEY("metric_name:factory.circuit.battery.input"),    Circuit.BatteryInput);
+        }
+        EventWriter.EndObject();
+        CommitEvent(ESplunkLane::Power);
+    });
+}
 
-    TSharedPtr<FJsonObject> Event = CreateMetricsEvent();
-    TSharedPtr<FJsonObject> Fields = MakeShareable(new FJsonObject);
-    Fields->SetNumberField(TEXT("metric_name:factory.players"), PlayerCount);
-    Event->SetObjectField(TEXT("fields"), Fields);
-    AddEventToBuffer(Event);
-    EventsInBuffer = DataBuffer.Num();
+void ASplunkExporter::WriteProductionMetrics(const FMetricsTotals& Totals, int64 Time)
+{
+    FSplunkEventEncoders::WriteProductionMetrics(EventWriter, Time, Totals.Manufacturers, Totals.Extractors, ClassMetrics, ResourceMetrics,
+        [this]() { CommitEvent(ESplunkLane::Metrics); });
 }
 
 void ASplunkExporter::CheckAndFlushBuffer()
 {
-    // Always flush on timer regardless of buffer size
-    if (DataBuffer.Num() > 0)
+    SPLUNK_SCOPE("Splunk::Flush", STAT_SplunkFlushTimer);
+
+    UpdateBackpressure();
+    EmitBufferMetrics();
+    EmitTimingMetrics();
+
+    // Without the controller, flush on timer regardless of buffer size
+    if (!FlushController)
     {
         SendBufferedData();
     }
+
+    ServiceSpool();
+    PublishProfilerCounters();
+}
+
+void ASplunkExporter::PublishProfilerCounters()
+{
+    // Mirrors of the self-metrics for `stat SplunkExporter` and the Insights counter tracks
+    const int64 BufferedEvents = Pipeline ? Pipeline->GetBufferedEvents() : 0;
+    const int64 BufferedBytes  = Pipeline ? Pipeline->GetBufferedBytes() : 0;
+    const int64 InFlight       = Sender ? Sender->GetInFlight() : 0;
+    const int64 InFlightBytes  = Sender ? Sender->GetInFlightBytes() : 0;
+
+    SET_DWORD_STAT(STAT_SplunkBufferedEvents, BufferedEvents);
+    SET_DWORD_STAT(STAT_SplunkBufferedBytes, BufferedBytes);
+    SET_DWORD_STAT(STAT_SplunkRequestsInFlight, InFlight);
+    SET_DWORD_STAT(STAT_SplunkBytesInFlight, InFlightBytes);
+
+    TRACE_COUNTER_SET(SplunkBufferedEvents, BufferedEvents);
+    TRACE_COUNTER_SET(SplunkBufferedBytes, BufferedBytes);
+    TRACE_COUNTER_SET(SplunkRequestsInFlight, InFlight);
+    TRACE_COUNTER_SET(SplunkBytesInFlight, InFlightBytes);
 }
 
-void ASplunkExporter::SendDataToSplunk(const FString& JsonData)
+void ASplunkExporter::DispatchRequest(TArray<uint8>&& Body, bool bGzipped)
 {
-    if (SplunkURL.IsEmpty() || HECToken.IsEmpty())
+    // Runs on the pipeline worker as well as the game thread: only touch the spool
+    // (thread-safe) and atomics here. Status counters are refreshed in ServiceSpool.
+
+    // While Splunk is known to be down, don't pile up requests that will fail; the spool replay probes for recovery
+    if (bSplunkUnavailable && Spool)
     {
-        UE_LOG(LogSatisfactorySplunkMod, Error, TEXT("SplunkExporter: Splunk URL or HEC Token not configured"));
+        Spool->Append(Body, bGzipped);
         return;
     }
 
-    FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
-    Request->OnProcessRequestComplete().BindUObject(this, &ASplunkExporter::OnHttpResponse);
-    
-    Request->SetURL(SplunkURL);
-    Request->SetVerb("POST");
-    Request->SetHeader("User-Agent", "SatisfactoryMod/1.0");
-    Request->SetHeader("Content-Type", "application/json");
-    Request->SetHeader("Authorization", FString::Printf(TEXT("Splunk %s"), *HECToken));
-    Request->SetContentAsString(JsonData);
-    
-    Request->ProcessRequest();
-}
-
-void ASplunkExporter::SendLayoutDataToSplunk(TSharedPtr<FJsonObject> LayoutData)
-{
-    if (!LayoutData.IsValid()) return;
-    
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(LayoutData.ToSharedRef(), Writer);
-    
-    SendDataToSplunk(OutputString);
+    if (Sender)
+    {
+        Sender->Send(MoveTemp(Body), bGzipped);
+    }
 }
 
 void ASplunkExporter::OnHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+    SPLUNK_SCOPE("Splunk::HttpResponse", STAT_SplunkHttpResponse);
+    ON_SCOPE_EXIT { PublishProfilerCounters(); };
+
+    if (Request.IsValid() && Request == AckPollRequest)
+    {
+        AckPollRequest.Reset();
+        OnAckPollResponse(Response, bWasSuccessful);
+        return;
+    }
+
+    HttpStatusCounts.FindOrAdd(bWasSuccessful && Response.IsValid() ? Response->GetResponseCode() : 0)++;
+
+    const bool bIsReplay = Request.IsValid() && Request == SpoolReplayRequest;
+    if (bIsReplay)
+    {
+        SpoolReplayRequest.Reset();
+    }
+    else if (Pipeline && Pipeline->GetBufferedEvents() > 0 && Sender && Sender->CanSend())
+    {
+        // A slot just freed up: send the backlog that coalesced while the sender was saturated
+        Pipeline->RequestDispatch();
+    }
+
+    if (FlushController && Pipeline)
+    {
+        const int32 Code = bWasSuccessful && Response.IsValid() ? Response->GetResponseCode() : 0;
+        if (Code >= 200 && Code < 300)
+        {
+            FlushController->OnSuccess(Sender ? Sender->GetLastLatencyMs() : 0.0f);
+        }
+        else if (Code == 0 || Code == 429 || Code >= 500)
+        {
+            FlushController->OnFailure();
+        }
+        Pipeline->SetAdaptiveFlush(FlushController->GetBatchBytes(), FlushController->GetMaxAge());
+    }
+
     if (!bWasSuccessful || !Response.IsValid())
     {
         UE_LOG(LogSatisfactorySplunkMod, Error,
             TEXT("SplunkExporter: Network error - could not reach Splunk at %s"), *SplunkURL);
+        OnSplunkUnavailable(Request, bIsReplay);
         return;
     }
 
@@ -1056,6 +1721,14 @@ void ASplunkExporter::OnHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr R
         UE_LOG(LogSatisfactorySplunkMod, Log,
             TEXT("SplunkExporter: Data sent successfully (HTTP %d). Total sends: %d"),
             ResponseCode, EventsSentTotal);
+
+        if (bIsReplay && Spool)
+        {
+            Spool->PopOldest();
+            BatchesReplayedTotal++;
+        }
+        TrackAck(Request, Response);
+        OnSplunkAvailable();
         return;
     }
 
@@ -1067,9 +1740,184 @@ void ASplunkExporter::OnHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr R
         case 401: Reason = TEXT("Unauthorized - HECToken is invalid or missing");     break;
         case 403: Reason = TEXT("Forbidden - HEC input may be disabled in Splunk");   break;
         case 404: Reason = TEXT("Not found - check SplunkURL path (/services/collector)"); break;
-        case 503: Reason = TEXT("Splunk is busy or unavailable - will retry on next cycle"); break;
+        case 503: Reason = TEXT("Splunk is busy or unavailable - batch spooled for retry"); break;
         default:  Reason = Response->GetContentAsString();                              break;
     }
     UE_LOG(LogSatisfactorySplunkMod, Error,
         TEXT("SplunkExporter: HTTP %d - %s"), ResponseCode, *Reason);
-}
\ No newline at end of file
+
+    // Busy/unavailable responses are worth retrying; anything else would fail again the same way
+    if (ResponseCode == 429 || ResponseCode >= 500)
+    {
+        OnSplunkUnavailable(Request, bIsReplay);
+    }
+    else if (bIsReplay && Spool)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Warning, TEXT("SplunkExporter: Dropping spooled batch rejected with HTTP %d"), ResponseCode);
+        Spool->PopOldest();
+        SpoolBytesOnDisk = Spool->GetDiskBytes();
+    }
+}
+
+void ASplunkExporter::OnSplunkUnavailable(FHttpRequestPtr Request, bool bIsReplay)
+{
+    if (!Spool) return;
+
+    // A failed replay is still at the head of the spool; a failed live batch has to be written out
+    if (!bIsReplay && Request.IsValid())
+    {
+        const bool bGzipped = Request->GetHeader(TEXT("Content-Encoding")) == TEXT("gzip");
+        Spool->Append(Request->GetContent(), bGzipped);
+    }
+    SpoolBytesOnDisk = Spool->GetDiskBytes();
+    BatchesSpooledTotal = Spool->GetAppendedRecords();
+
+    // Live batches that were already in flight when Splunk went down fail together; only a
+    // failed replay probe means a retry cycle failed, so only that grows the backoff
+    if (bSplunkUnavailable && !bIsReplay) return;
+
+    // Exponential backoff with jitter so many clients don't hammer a recovering indexer in lockstep
+    if (bSplunkUnavailable)
+    {
+        SpoolBackoffSeconds = FMath::Min(SpoolBackoffSeconds * 2.0f, SpoolRetryMaxSeconds);
+    }
+    else
+    {
+        SpoolBackoffSeconds = SpoolRetryMinSeconds;
+    }
+    bSplunkUnavailable = true;
+    NextSpoolRetryTime = FPlatformTime::Seconds() + SpoolBackoffSeconds * FMath::FRandRange(0.8f, 1.2f);
+
+    UE_LOG(LogSatisfactorySplunkMod, Warning,
+        TEXT("SplunkExporter: Splunk unavailable, spooling to disk (%lld bytes). Next retry in %.1fs"),
+        SpoolBytesOnDisk, SpoolBackoffSeconds);
+}
+
+void ASplunkExporter::OnSplunkAvailable()
+{
+    if (bSplunkUnavailable)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkExporter: Splunk reachable again, replaying spool"));
+    }
+    bSplunkUnavailable = false;
+    SpoolBackoffSeconds = SpoolRetryMinSeconds;
+    NextSpoolRetryTime = 0.0;
+
+    // Drain the spool one batch per response so replay never floods a freshly restarted indexer
+    ServiceSpool();
+}
+
+void ASplunkExporter::ServiceSpool()
+{
+    if (!Spool) return;
+    SpoolBytesOnDisk = Spool->GetDiskBytes();
+    BatchesSpooledTotal = Spool->GetAppendedRecords();
+
+    if (SpoolReplayRequest.IsValid()) return;
+    if (FPlatformTime::Seconds() < NextSpoolRetryTime) return;
+    if (!Sender || !Sender->CanSend()) return;
+
+    TArray<uint8> Payload;
+    bool bGzipped = false;
+    if (!Spool->PeekOldest(Payload, bGzipped))
+    {
+        SpoolBytesOnDisk = 0;
+        return;
+    }
+
+    SpoolReplayRequest = Sender->Send(MoveTemp(Payload), bGzipped);
+    SpoolBytesOnDisk = Spool->GetDiskBytes();
+}
+
+// ===== INDEXER ACKNOWLEDGEMENT =====
+
+void ASplunkExporter::TrackAck(FHttpRequestPtr Request, FHttpResponsePtr Response)
+{
+    if (!Acks || !Request.IsValid()) return;
+
+    int64 AckId = 0;
+    if (!FSplunkAckTracker::ParseAckId(Response->GetContentAsString(), AckId))
+    {
+        if (!bWarnedAckDisabled)
+        {
+            UE_LOG(LogSatisfactorySplunkMod, Warning,
+                TEXT("SplunkExporter: bUseIndexerAck is set but HEC returned no ackId - enable indexer acknowledgement on the token"));
+            bWarnedAckDisabled = true;
+        }
+        return;
+    }
+
+    const bool bGzipped = Request->GetHeader(TEXT("Content-Encoding")) == TEXT("gzip");
+    TArray<uint8> Body = Request->GetContent();
+    Acks->Add(AckId, MoveTemp(Body), bGzipped, FPlatformTime::Seconds());
+    BatchesAwaitingAck = Acks->Num();
+}
+
+void ASplunkExporter::PollAcks()
+{
+    if (!Acks || !Sender || AckPollRequest.IsValid()) return;
+
+    // Resend what Splunk has had long enough to commit; it goes through the normal path (and the spool if down)
+    TArray<FSplunkAckTracker::FBatch> Expired;
+    Acks->TakeExpired(FPlatformTime::Seconds(), AckTimeoutSeconds, Expired);
+    if (Expired.Num() > 0)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Warning,
+            TEXT("SplunkExporter: %d batch(es) not acknowledged within %.0fs or orphaned by a Splunk restart, resending"), Expired.Num(), AckTimeoutSeconds);
+        for (FSplunkAckTracker::FBatch& Batch : Expired)
+        {
+            DispatchRequest(MoveTemp(Batch.Body), Batch.bGzipped);
+        }
+        BatchesResentTotal += Expired.Num();
+    }
+
+    // Evicted batches were received, just not confirmed yet; they are dropped from tracking, not resent
+    const int64 Evicted = Acks->GetEvictedTotal();
+    if (Evicted > LastLoggedAckEvictions)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Warning,
+            TEXT("SplunkExporter: %lld batch(es) stopped awaiting acknowledgement because AckMaxPendingMB is full; not resending"),
+            Evicted - LastLoggedAckEvictions);
+        LastLoggedAckEvictions = Evicted;
+    }
+    BatchesAwaitingAck = Acks->Num();
+
+    // Nothing to ask about while Splunk is unreachable; the spool probe detects recovery
+    if (bSplunkUnavailable) return;
+
+    TArray<uint8> Body;
+    if (Acks->BuildPollRequest(Body))
+    {
+        AckPollRequest = Sender->Post(GetAckURL(), MoveTemp(Body), false);
+    }
+}
+
+void ASplunkExporter::OnAckPollResponse(FHttpResponsePtr Response, bool bWasSuccessful)
+{
+    if (!Acks) return;
+
+    if (!bWasSuccessful || !Response.IsValid() || Response->GetResponseCode() != 200)
+    {
+        // Unanswered IDs simply stay pending; the timeout resends them if this persists
+        UE_LOG(LogSatisfactorySplunkMod, Verbose, TEXT("SplunkExporter: Ack poll failed (HTTP %d)"),
+            Response.IsValid() ? Response->GetResponseCode() : 0);
+        return;
+    }
+
+    const int32 Released = Acks->ApplyPollResponse(Response->GetContentAsString());
+    BatchesAckedTotal = Acks->GetAckedTotal();
+    BatchesAwaitingAck = Acks->Num();
+    UE_LOG(LogSatisfactorySplunkMod, Verbose, TEXT("SplunkExporter: %d batch(es) acknowledged, %d pending"), Released, BatchesAwaitingAck);
+}
+
+FString ASplunkExporter::GetAckURL() const
+{
+    // https://host:8088/services/collector[/event|/raw...] -> https://host:8088/services/collector/ack
+    static const TCHAR* CollectorPath = TEXT("/services/collector");
+    const int32 PathStart = SplunkURL.Find(CollectorPath, ESearchCase::IgnoreCase);
+    if (PathStart == INDEX_NONE)
+    {
+        return SplunkURL / TEXT("ack");
+    }
+    return SplunkURL.Left(PathStart + FCString::Strlen(CollectorPath)) + TEXT("/ack");
+}
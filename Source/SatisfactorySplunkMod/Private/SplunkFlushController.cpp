@@ -0,0 +1,78 @@
+#include "SplunkFlushController.h"
+
+namespace SplunkFlushController
+{
+    // Weight of the newest sample in the moving averages
+    static constexpr float LatencySmoothing = 0.2f;
+    static constexpr float ErrorSmoothing = 0.1f;
+
+    // Share of the gap to the smoothed latency the baseline closes per sample, so it re-learns after a move
+    static constexpr float BaselineDrift = 0.01f;
+
+    // No growth while more than this share of recent batches failed
+    static constexpr float HealthyErrorRate = 0.01f;
+
+    static constexpr float LatencyDecrease = 0.75f;
+    static constexpr float ErrorDecrease = 0.5f;
+}
+
+FSplunkFlushController::FSplunkFlushController(const FSplunkFlushControllerConfig& InConfig)
+    : Config(InConfig)
+    , BatchBytes(FMath::Clamp(InConfig.StartBatchBytes, InConfig.MinBatchBytes, InConfig.MaxBatchBytes))
+    , MaxAge(InConfig.BaseMaxAge)
+{
+}
+
+void FSplunkFlushController::OnSuccess(float LatencyMs)
+{
+    using namespace SplunkFlushController;
+
+    ErrorRate = FMath::Lerp(ErrorRate, 0.0f, ErrorSmoothing);
+
+    if (SmoothedLatencyMs <= 0.0f)
+    {
+        SmoothedLatencyMs = LatencyMs;
+        BaselineLatencyMs = LatencyMs;
+    }
+    else
+    {
+        SmoothedLatencyMs = FMath::Lerp(SmoothedLatencyMs, LatencyMs, LatencySmoothing);
+        BaselineLatencyMs = FMath::Min(LatencyMs, FMath::Lerp(BaselineLatencyMs, SmoothedLatencyMs, BaselineDrift));
+    }
+
+    if (SmoothedLatencyMs > BaselineLatencyMs * Config.LatencyTolerance)
+    {
+        Decrease(LatencyDecrease);
+        return;
+    }
+
+    // Healthy again: stop backing off before growing
+    MaxAge = FMath::Max(Config.BaseMaxAge, MaxAge * 0.5f);
+    if (ErrorRate <= HealthyErrorRate && BatchBytes < Config.MaxBatchBytes)
+    {
+        BatchBytes = FMath::Min(BatchBytes + Config.IncreaseStepBytes, Config.MaxBatchBytes);
+        Increases++;
+    }
+}
+
+void FSplunkFlushController::OnFailure()
+{
+    using namespace SplunkFlushController;
+
+    ErrorRate = FMath::Lerp(ErrorRate, 1.0f, ErrorSmoothing);
+    if (Decrease(ErrorDecrease))
+    {
+        MaxAge = FMath::Min(MaxAge * 2.0f, Config.MaxMaxAge);
+    }
+}
+
+bool FSplunkFlushController::Decrease(float Factor)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (Now - LastDecreaseTime < SmoothedLatencyMs / 1000.0) return false;
+
+    LastDecreaseTime = Now;
+    BatchBytes = FMath::Max((int32)(BatchBytes * Factor), Config.MinBatchBytes);
+    Decreases++;
+    return true;
+}
@@ -0,0 +1,80 @@
+#include "SplunkGzip.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+bool FSplunkGzip::Compress(const uint8* Data, int32 Len, int32 Level, TArray<uint8>& Out)
+{
+    Out.Reset();
+
+    z_stream Stream;
+    FMemory::Memzero(Stream);
+
+    // windowBits 15 + 16 asks zlib for a gzip header/trailer instead of a raw zlib stream
+    if (deflateInit2(&Stream, FMath::Clamp(Level, 1, 9), Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return false;
+    }
+
+    // deflateBound is exact for a single Z_FINISH call, so one allocation is enough
+    Out.SetNumUninitialized((int32)deflateBound(&Stream, (uLong)Len));
+
+    Stream.next_in   = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(Data));
+    Stream.avail_in  = (uInt)Len;
+    Stream.next_out  = reinterpret_cast<Bytef*>(Out.GetData());
+    Stream.avail_out = (uInt)Out.Num();
+
+    const int Result = deflate(&Stream, Z_FINISH);
+    const uLong CompressedSize = Stream.total_out;
+    deflateEnd(&Stream);
+
+    if (Result != Z_STREAM_END)
+    {
+        Out.Reset();
+        return false;
+    }
+
+    Out.SetNum((int32)CompressedSize, false);
+    return true;
+}
+
+bool FSplunkGzip::Decompress(const uint8* Data, int32 Len, TArray<uint8>& Out)
+{
+    Out.Reset();
+
+    z_stream Stream;
+    FMemory::Memzero(Stream);
+
+    if (inflateInit2(&Stream, 15 + 16) != Z_OK)
+    {
+        return false;
+    }
+
+    Stream.next_in  = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(Data));
+    Stream.avail_in = (uInt)Len;
+
+    // JSON usually inflates 5-10x; grow until the whole member is out
+    int Result = Z_OK;
+    int32 Capacity = FMath::Max(Len * 8, 4096);
+    while (Result == Z_OK)
+    {
+        Out.SetNumUninitialized(Capacity, false);
+        Stream.next_out  = reinterpret_cast<Bytef*>(Out.GetData() + Stream.total_out);
+        Stream.avail_out = (uInt)(Capacity - Stream.total_out);
+
+        Result = inflate(&Stream, Z_NO_FLUSH);
+        Capacity *= 2;
+    }
+    const uLong InflatedSize = Stream.total_out;
+    inflateEnd(&Stream);
+
+    if (Result != Z_STREAM_END)
+    {
+        Out.Reset();
+        return false;
+    }
+
+    Out.SetNum((int32)InflatedSize, false);
+    return true;
+}
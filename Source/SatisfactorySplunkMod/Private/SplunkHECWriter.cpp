@@ -0,0 +1,269 @@
+#include "SplunkHECWriter.h"
+
+void FSplunkHECWriter::BeginEvent(int64 UnixTime, FSplunkHECToken SourceType)
+{
+    check(FirstInScope.Num() == 0);
+    PushScope('{');
+
+    // "time" stays a quoted string to match the format dashboards already parse
+    WriteKey(SPLUNK_HEC_KEY("time"));
+    AppendChar('"');
+    AppendInt(UnixTime);
+    AppendChar('"');
+
+    WriteString(SPLUNK_HEC_KEY("host"), SPLUNK_HEC_STRING("satisfactory-game"));
+    WriteString(SPLUNK_HEC_KEY("sourcetype"), SourceType);
+}
+
+void FSplunkHECWriter::BeginMetricsEvent(int64 UnixTime)
+{
+    check(FirstInScope.Num() == 0);
+    PushScope('{');
+
+    WriteKey(SPLUNK_HEC_KEY("time"));
+    AppendChar('"');
+    AppendInt(UnixTime);
+    AppendChar('"');
+
+    WriteString(SPLUNK_HEC_KEY("event"), SPLUNK_HEC_STRING("metric"));
+    WriteString(SPLUNK_HEC_KEY("source"), SPLUNK_HEC_STRING("satisfactory-mod"));
+    WriteString(SPLUNK_HEC_KEY("sourcetype"), SPLUNK_HEC_STRING("satisfactory:metrics"));
+}
+
+void FSplunkHECWriter::EndEvent()
+{
+    PopScope('}');
+    check(FirstInScope.Num() == 0);
+
+    // HEC batch format: one JSON object per line (NOT wrapped in an array)
+    AppendChar('\n');
+    EventCount++;
+}
+
+void FSplunkHECWriter::BeginObject(FSplunkHECToken Key)
+{
+    WriteKey(Key);
+    PushScope('{');
+}
+
+void FSplunkHECWriter::BeginObject()
+{
+    WriteSeparator();
+    PushScope('{');
+}
+
+void FSplunkHECWriter::EndObject()
+{
+    PopScope('}');
+}
+
+void FSplunkHECWriter::BeginArray(FSplunkHECToken Key)
+{
+    WriteKey(Key);
+    PushScope('[');
+}
+
+void FSplunkHECWriter::EndArray()
+{
+    PopScope(']');
+}
+
+void FSplunkHECWriter::WriteString(FSplunkHECToken Key, const FString& Value)
+{
+    WriteKey(Key);
+    AppendChar('"');
+    AppendEscaped(*Value, Value.Len());
+    AppendChar('"');
+}
+
+void FSplunkHECWriter::WriteString(FSplunkHECToken Key, const TCHAR* Value)
+{
+    WriteKey(Key);
+    AppendChar('"');
+    AppendEscaped(Value, FCString::Strlen(Value));
+    AppendChar('"');
+}
+
+void FSplunkHECWriter::WriteString(FSplunkHECToken Key, FSplunkHECToken Value)
+{
+    WriteKey(Key);
+    AppendToken(Value);
+}
+
+void FSplunkHECWriter::WriteEscapedString(FSplunkHECToken Key, const uint8* Escaped, int32 Len)
+{
+    WriteKey(Key);
+    AppendChar('"');
+    const int32 Offset = Buffer.AddUninitialized(Len);
+    FMemory::Memcpy(Buffer.GetData() + Offset, Escaped, Len);
+    AppendChar('"');
+}
+
+void FSplunkHECWriter::WriteNumber(FSplunkHECToken Key, double Value)
+{
+    WriteKey(Key);
+    AppendNumber(Value);
+}
+
+void FSplunkHECWriter::WriteInt(FSplunkHECToken Key, int64 Value)
+{
+    WriteKey(Key);
+    AppendInt(Value);
+}
+
+void FSplunkHECWriter::WriteBool(FSplunkHECToken Key, bool Value)
+{
+    WriteKey(Key);
+    if (Value)
+    {
+        AppendBytes("true", 4);
+    }
+    else
+    {
+        AppendBytes("false", 5);
+    }
+}
+
+void FSplunkHECWriter::Reset()
+{
+    Buffer.Reset();
+    FirstInScope.Reset();
+    EventCount = 0;
+}
+
+TArray<uint8> FSplunkHECWriter::ReleaseBuffer()
+{
+    TArray<uint8> Out = MoveTemp(Buffer);
+    Reset();
+    return Out;
+}
+
+void FSplunkHECWriter::WriteKey(FSplunkHECToken Key)
+{
+    WriteSeparator();
+    AppendToken(Key);
+}
+
+void FSplunkHECWriter::WriteSeparator()
+{
+    check(FirstInScope.Num() > 0);
+    bool& bFirst = FirstInScope.Last();
+    if (!bFirst)
+    {
+        AppendChar(',');
+    }
+    bFirst = false;
+}
+
+void FSplunkHECWriter::PushScope(ANSICHAR Open)
+{
+    AppendChar(Open);
+    FirstInScope.Add(true);
+}
+
+void FSplunkHECWriter::PopScope(ANSICHAR Close)
+{
+    check(FirstInScope.Num() > 0);
+    FirstInScope.Pop(false);
+    AppendChar(Close);
+}
+
+void FSplunkHECWriter::AppendBytes(const ANSICHAR* Bytes, int32 Len)
+{
+    const int32 Offset = Buffer.AddUninitialized(Len);
+    FMemory::Memcpy(Buffer.GetData() + Offset, Bytes, Len);
+}
+
+void FSplunkHECWriter::Escape(const TCHAR* Str, int32 Len, TArray<uint8>& OutBuffer)
+{
+    static const ANSICHAR HexDigits[] = "0123456789abcdef";
+
+    // Worst case is 6 output bytes per input char (\u00XX); reserve once, trim at the end
+    const int32 Start = OutBuffer.AddUninitialized(Len * 6);
+    uint8* Out = OutBuffer.GetData() + Start;
+
+    for (int32 i = 0; i < Len; i++)
+    {
+        uint32 Code = (uint32)Str[i];
+
+        // Combine UTF-16 surrogate pairs
+        if (Code >= 0xD800 && Code <= 0xDBFF && i + 1 < Len)
+        {
+            const uint32 Low = (uint32)Str[i + 1];
+            if (Low >= 0xDC00 && Low <= 0xDFFF)
+            {
+                Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+                i++;
+            }
+        }
+
+        switch (Code)
+        {
+            case '"':  *Out++ = '\\'; *Out++ = '"';  continue;
+            case '\\': *Out++ = '\\'; *Out++ = '\\'; continue;
+            case '\n': *Out++ = '\\'; *Out++ = 'n';  continue;
+            case '\r': *Out++ = '\\'; *Out++ = 'r';  continue;
+            case '\t': *Out++ = '\\'; *Out++ = 't';  continue;
+            default: break;
+        }
+
+        if (Code < 0x20)
+        {
+            *Out++ = '\\'; *Out++ = 'u'; *Out++ = '0'; *Out++ = '0';
+            *Out++ = HexDigits[(Code >> 4) & 0xF];
+            *Out++ = HexDigits[Code & 0xF];
+        }
+        else if (Code < 0x80)
+        {
+            *Out++ = (uint8)Code;
+        }
+        else if (Code < 0x800)
+        {
+            *Out++ = (uint8)(0xC0 | (Code >> 6));
+            *Out++ = (uint8)(0x80 | (Code & 0x3F));
+        }
+        else if (Code < 0x10000)
+        {
+            *Out++ = (uint8)(0xE0 | (Code >> 12));
+            *Out++ = (uint8)(0x80 | ((Code >> 6) & 0x3F));
+            *Out++ = (uint8)(0x80 | (Code & 0x3F));
+        }
+        else
+        {
+            *Out++ = (uint8)(0xF0 | (Code >> 18));
+            *Out++ = (uint8)(0x80 | ((Code >> 12) & 0x3F));
+            *Out++ = (uint8)(0x80 | ((Code >> 6) & 0x3F));
+            *Out++ = (uint8)(0x80 | (Code & 0x3F));
+        }
+    }
+
+    OutBuffer.SetNum((int32)(Out - OutBuffer.GetData()), false);
+}
+
+void FSplunkHECWriter::AppendNumber(double Value)
+{
+    // JSON has no NaN/Inf; HEC rejects the whole batch if one slips through
+    if (!FMath::IsFinite(Value))
+    {
+        AppendBytes("null", 4);
+        return;
+    }
+
+    // Counts and whole-number readings are written without a fractional part
+    if (Value == FMath::RoundToDouble(Value) && FMath::Abs(Value) < 1e15)
+    {
+        AppendInt((int64)Value);
+        return;
+    }
+
+    ANSICHAR Scratch[32];
+    const int32 Len = FCStringAnsi::Snprintf(Scratch, UE_ARRAY_COUNT(Scratch), "%.10g", Value);
+    AppendBytes(Scratch, Len);
+}
+
+void FSplunkHECWriter::AppendInt(int64 Value)
+{
+    ANSICHAR Scratch[24];
+    const int32 Len = FCStringAnsi::Snprintf(Scratch, UE_ARRAY_COUNT(Scratch), "%lld", (long long)Value);
+    AppendBytes(Scratch, Len);
+}
@@ -0,0 +1,48 @@
+#include "SplunkHistogram.h"
+
+void FSplunkHistogram::Record(double Microseconds)
+{
+    Buckets[GetBucket(Microseconds)]++;
+    Count++;
+    Max = FMath::Max(Max, Microseconds);
+}
+
+double FSplunkHistogram::GetPercentile(double P) const
+{
+    if (Count == 0) return 0.0;
+
+    // Rank of the sample we're after, 1-based
+    const int64 Rank = FMath::Clamp<int64>((int64)FMath::CeilToDouble(P * Count), 1, Count);
+    int64 Seen = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+    {
+        Seen += Buckets[Bucket];
+        if (Seen >= Rank)
+        {
+            // Never report more than was actually observed
+            return FMath::Min(GetBucketUpperBound(Bucket), Max);
+        }
+    }
+    return Max;
+}
+
+void FSplunkHistogram::Reset()
+{
+    FMemory::Memzero(Buckets);
+    Count = 0;
+    Max = 0.0;
+}
+
+int32 FSplunkHistogram::GetBucket(double Microseconds)
+{
+    if (Microseconds < 1.0) return 0;
+
+    // Bucket = SubBuckets * log2(x), i.e. SubBuckets buckets per doubling
+    const int32 Bucket = FMath::FloorToInt(FMath::Log2(Microseconds) * SubBuckets);
+    return FMath::Clamp(Bucket, 0, NumBuckets - 1);
+}
+
+double FSplunkHistogram::GetBucketUpperBound(int32 Bucket)
+{
+    return FMath::Pow(2.0, (double)(Bucket + 1) / SubBuckets);
+}
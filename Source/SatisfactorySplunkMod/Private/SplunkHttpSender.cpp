@@ -0,0 +1,61 @@
+#include "SplunkHttpSender.h"
+
+namespace SplunkHttpSender
+{
+    // Weight of the newest sample in the moving latency average
+    static constexpr float LatencySmoothing = 0.2f;
+}
+
+FSplunkHttpSender::FSplunkHttpSender(const FSplunkHttpSenderConfig& InConfig, FCompleteFunc InOnComplete)
+    : Config(InConfig)
+    , AuthorizationHeader(FString::Printf(TEXT("Splunk %s"), *InConfig.HECToken))
+    , OnComplete(MoveTemp(InOnComplete))
+{
+}
+
+FHttpRequestPtr FSplunkHttpSender::Post(const FString& URL, TArray<uint8>&& Body, bool bGzipped)
+{
+    const int64 Bytes = Body.Num();
+
+    FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
+    Request->OnProcessRequestComplete().BindThreadSafeSP(AsShared(), &FSplunkHttpSender::OnRequestComplete, FPlatformTime::Seconds(), Bytes);
+
+    Request->SetURL(URL);
+    Request->SetVerb(TEXT("POST"));
+    Request->SetHeader(TEXT("User-Agent"), TEXT("SatisfactoryMod/1.0"));
+    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    Request->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+    Request->SetHeader(TEXT("Authorization"), AuthorizationHeader);
+    if (!Config.Channel.IsEmpty())
+    {
+        Request->SetHeader(TEXT("X-Splunk-Request-Channel"), Config.Channel);
+    }
+    if (bGzipped)
+    {
+        Request->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+    }
+    Request->SetContent(MoveTemp(Body));
+
+    InFlight++;
+    InFlightBytes += Bytes;
+    Request->ProcessRequest();
+    return Request;
+}
+
+void FSplunkHttpSender::OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, double StartTime, int64 Bytes)
+{
+    InFlight--;
+    InFlightBytes -= Bytes;
+
+    const double LatencySeconds = FPlatformTime::Seconds() - StartTime;
+    LatencyHistogram.Record(LatencySeconds * 1000000.0);
+    LastLatencyMs = (float)(LatencySeconds * 1000.0);
+    AverageLatencyMs = AverageLatencyMs > 0.0f
+        ? FMath::Lerp(AverageLatencyMs, LastLatencyMs, SplunkHttpSender::LatencySmoothing)
+        : LastLatencyMs;
+
+    if (OnComplete)
+    {
+        OnComplete(Request, Response, bWasSuccessful);
+    }
+}
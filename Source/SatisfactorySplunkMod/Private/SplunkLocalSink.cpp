@@ -0,0 +1,314 @@
+#include "SplunkLocalSink.h"
+#include "SatisfactorySplunkMod.h"
+#include "SplunkGzip.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "HttpPath.h"
+#include "IHttpRouter.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace SplunkLocalSink
+{
+    // Interval of the events/sec line in the log while the sink is receiving
+    static constexpr double StatsLogInterval = 10.0;
+
+    /**
+     * The HTTP server binds to [HTTPServer.Listeners] DefaultBindAddress, which may be every interface.
+     * A per-port override keeps this port on loopback; it must be in place before the listener is created.
+     */
+    static void BindToLoopback(int32 Port)
+    {
+        static const TCHAR* Section = TEXT("HTTPServer.Listeners");
+        TArray<FString> Overrides;
+        GConfig->GetArray(Section, TEXT("ListenerOverrides"), Overrides, GEngineIni);
+        Overrides.RemoveAll([Port](const FString& Override)
+        {
+            int32 OverridePort = 0;
+            return FParse::Value(*Override, TEXT("Port="), OverridePort) && OverridePort == Port;
+        });
+        Overrides.Add(FString::Printf(TEXT("(Port=%d,BindAddress=127.0.0.1)"), Port));
+        GConfig->SetArray(Section, TEXT("ListenerOverrides"), Overrides, GEngineIni);
+    }
+
+    static FAutoConsoleCommand FaultsCommand(
+        TEXT("splunk.sink.Faults"),
+        TEXT("Sets local HEC sink fault injection: splunk.sink.Faults <LatencyMs> <ErrorRate 0-1> <DropRate 0-1>"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            TSharedPtr<FSplunkLocalSink> Sink = FSplunkLocalSink::GetActive();
+            if (!Sink)
+            {
+                UE_LOG(LogSatisfactorySplunkMod, Warning, TEXT("SplunkLocalSink: Not running (set bRunLocalSink=True)"));
+                return;
+            }
+            Sink->SetFaults(
+                Args.IsValidIndex(0) ? FCString::Atof(*Args[0]) : 0.0f,
+                Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 0.0f,
+                Args.IsValidIndex(2) ? FCString::Atof(*Args[2]) : 0.0f);
+        }));
+
+    static FAutoConsoleCommand StatsCommand(
+        TEXT("splunk.sink.Stats"),
+        TEXT("Logs what the local HEC sink has received"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            if (TSharedPtr<FSplunkLocalSink> Sink = FSplunkLocalSink::GetActive())
+            {
+                Sink->LogStats();
+            }
+        }));
+}
+
+TWeakPtr<FSplunkLocalSink> FSplunkLocalSink::Active;
+
+FSplunkLocalSink::FSplunkLocalSink(const FSplunkLocalSinkConfig& InConfig)
+    : Config(InConfig)
+    , ExpectedAuthorization(FString::Printf(TEXT("Splunk %s"), *InConfig.HECToken))
+    , Random(FPlatformTime::Cycles())
+{
+}
+
+FSplunkLocalSink::~FSplunkLocalSink()
+{
+    Stop();
+}
+
+bool FSplunkLocalSink::Start()
+{
+    // It accepts the placeholder token and injects faults on request, so it must not be reachable from the network
+    SplunkLocalSink::BindToLoopback(Config.Port);
+    Router = FHttpServerModule::Get().GetHttpRouter(Config.Port, /*bFailOnBindFailure*/ true);
+    if (!Router)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Error, TEXT("SplunkLocalSink: Could not listen on port %d"), Config.Port);
+        return false;
+    }
+
+    const FHttpRequestHandler EventsHandler = FHttpRequestHandler::CreateSP(this, &FSplunkLocalSink::HandleEvents);
+    Routes.Add(Router->BindRoute(FHttpPath(TEXT("/services/collector")), EHttpServerRequestVerbs::VERB_POST, EventsHandler));
+    Routes.Add(Router->BindRoute(FHttpPath(TEXT("/services/collector/event")), EHttpServerRequestVerbs::VERB_POST, EventsHandler));
+    Routes.Add(Router->BindRoute(FHttpPath(TEXT("/services/collector/ack")), EHttpServerRequestVerbs::VERB_POST,
+        FHttpRequestHandler::CreateSP(this, &FSplunkLocalSink::HandleAck)));
+    FHttpServerModule::Get().StartAllListeners();
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FSplunkLocalSink::Tick));
+
+    Stats = FStats();
+    Stats.StartTime = FPlatformTime::Seconds();
+    NextStatsLogTime = Stats.StartTime + SplunkLocalSink::StatsLogInterval;
+    Active = AsShared();
+
+    UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkLocalSink: Listening at %s (latency %.0f ms, errors %.0f%%, drops %.0f%%)"),
+        *GetURL(), Config.LatencyMs, Config.ErrorRate * 100.0f, Config.DropRate * 100.0f);
+    return true;
+}
+
+void FSplunkLocalSink::Stop()
+{
+    if (!Router) return;
+
+    for (const FHttpRouteHandle& Route : Routes)
+    {
+        Router->UnbindRoute(Route);
+    }
+    Routes.Reset();
+    Router.Reset();
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+    // Answer delayed batches so nothing is lost on shutdown; held ones were meant to die
+    for (FPendingResponse& Pending : Delayed)
+    {
+        TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Pending.Body, TEXT("application/json"));
+        Response->Code = (EHttpServerResponseCodes)Pending.Code;
+        Pending.OnComplete(MoveTemp(Response));
+    }
+    Delayed.Reset();
+    Held.Reset();
+
+    LogStats();
+}
+
+FString FSplunkLocalSink::GetURL() const
+{
+    return FString::Printf(TEXT("http://127.0.0.1:%d/services/collector"), Config.Port);
+}
+
+void FSplunkLocalSink::SetFaults(float LatencyMs, float ErrorRate, float DropRate)
+{
+    Config.LatencyMs = FMath::Max(LatencyMs, 0.0f);
+    Config.ErrorRate = FMath::Clamp(ErrorRate, 0.0f, 1.0f);
+    Config.DropRate = FMath::Clamp(DropRate, 0.0f, 1.0f);
+    UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkLocalSink: Faults set - latency %.0f ms, errors %.0f%%, drops %.0f%%"),
+        Config.LatencyMs, Config.ErrorRate * 100.0f, Config.DropRate * 100.0f);
+}
+
+double FSplunkLocalSink::GetEventsPerSecond() const
+{
+    const double Elapsed = FPlatformTime::Seconds() - Stats.StartTime;
+    return Elapsed > 0.0 ? Stats.Events / Elapsed : 0.0;
+}
+
+void FSplunkLocalSink::LogStats() const
+{
+    UE_LOG(LogSatisfactorySplunkMod, Log,
+        TEXT("SplunkLocalSink: %lld requests, %lld events (%.0f/s), %lld bytes received (%lld decoded), %lld unauthorized, %lld malformed, %lld injected 503s, %lld dropped"),
+        Stats.Requests, Stats.Events, GetEventsPerSecond(), Stats.WireBytes, Stats.DecodedBytes,
+        Stats.Unauthorized, Stats.Malformed, Stats.InjectedErrors, Stats.InjectedDrops);
+}
+
+bool FSplunkLocalSink::HandleEvents(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    Stats.Requests++;
+    Stats.WireBytes += Request.Body.Num();
+
+    const FString* Authorization = FindHeader(Request, TEXT("Authorization"));
+    if (!Authorization || *Authorization != ExpectedAuthorization)
+    {
+        Stats.Unauthorized++;
+        Respond(401, TEXT("{\"text\":\"Invalid token\",\"code\":4}"), OnComplete);
+        return true;
+    }
+
+    // Faults are decided before decoding, like a busy indexer that never looks at the batch
+    if (Random.FRand() < Config.DropRate)
+    {
+        Stats.InjectedDrops++;
+        Held.Add(OnComplete);
+        return true;
+    }
+    if (Random.FRand() < Config.ErrorRate)
+    {
+        Stats.InjectedErrors++;
+        Respond(503, TEXT("{\"text\":\"Server is busy\",\"code\":9}"), OnComplete);
+        return true;
+    }
+
+    TArray<uint8> Inflated;
+    const FString* Encoding = FindHeader(Request, TEXT("Content-Encoding"));
+    const bool bGzipped = Encoding && Encoding->Equals(TEXT("gzip"), ESearchCase::IgnoreCase);
+    if (bGzipped && !FSplunkGzip::Decompress(Request.Body.GetData(), Request.Body.Num(), Inflated))
+    {
+        Stats.Malformed++;
+        Respond(400, TEXT("{\"text\":\"Invalid data format\",\"code\":6}"), OnComplete);
+        return true;
+    }
+    const TArray<uint8>& Body = bGzipped ? Inflated : Request.Body;
+
+    int64 Events = 0;
+    for (int32 i = 0; i < Body.Num(); i++)
+    {
+        Events += Body[i] == '\n';
+    }
+    if (Body.Num() > 0 && Body.Last() != '\n')
+    {
+        Events++;
+    }
+    if (Events == 0)
+    {
+        Stats.Malformed++;
+        Respond(400, TEXT("{\"text\":\"No data\",\"code\":5}"), OnComplete);
+        return true;
+    }
+    Stats.Events += Events;
+    Stats.DecodedBytes += Body.Num();
+
+    FString Response = FindHeader(Request, TEXT("X-Splunk-Request-Channel"))
+        ? FString::Printf(TEXT("{\"text\":\"Success\",\"code\":0,\"ackId\":%lld}"), NextAckId++)
+        : FString(TEXT("{\"text\":\"Success\",\"code\":0}"));
+    Respond(200, MoveTemp(Response), OnComplete);
+    return true;
+}
+
+bool FSplunkLocalSink::HandleAck(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    const FString* Authorization = FindHeader(Request, TEXT("Authorization"));
+    if (!Authorization || *Authorization != ExpectedAuthorization)
+    {
+        Respond(401, TEXT("{\"text\":\"Invalid token\",\"code\":4}"), OnComplete);
+        return true;
+    }
+
+    // Everything accepted is committed immediately, so every ID asked about is acked
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
+    const FString Json(Converted.Length(), Converted.Get());
+
+    TSharedPtr<FJsonObject> Root;
+    const TArray<TSharedPtr<FJsonValue>>* Ids = nullptr;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root || !Root->TryGetArrayField(TEXT("acks"), Ids))
+    {
+        Respond(400, TEXT("{\"text\":\"Invalid data format\",\"code\":6}"), OnComplete);
+        return true;
+    }
+
+    FString Response = TEXT("{\"acks\":{");
+    for (int32 i = 0; i < Ids->Num(); i++)
+    {
+        Response += FString::Printf(TEXT("%s\"%lld\":true"), i > 0 ? TEXT(",") : TEXT(""), (int64)(*Ids)[i]->AsNumber());
+    }
+    Response += TEXT("}}");
+    Respond(200, MoveTemp(Response), OnComplete);
+    return true;
+}
+
+void FSplunkLocalSink::Respond(int32 Code, FString&& Body, const FHttpResultCallback& OnComplete)
+{
+    if (Config.LatencyMs > 0.0f)
+    {
+        Delayed.Add({ FPlatformTime::Seconds() + Config.LatencyMs / 1000.0, Code, MoveTemp(Body), OnComplete });
+        return;
+    }
+
+    TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Body, TEXT("application/json"));
+    Response->Code = (EHttpServerResponseCodes)Code;
+    OnComplete(MoveTemp(Response));
+}
+
+bool FSplunkLocalSink::Tick(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    for (int32 i = 0; i < Delayed.Num(); )
+    {
+        if (Delayed[i].DueTime > Now)
+        {
+            i++;
+            continue;
+        }
+        FPendingResponse Pending = MoveTemp(Delayed[i]);
+        Delayed.RemoveAtSwap(i, 1, false);
+
+        TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Pending.Body, TEXT("application/json"));
+        Response->Code = (EHttpServerResponseCodes)Pending.Code;
+        Pending.OnComplete(MoveTemp(Response));
+    }
+
+    if (Now >= NextStatsLogTime)
+    {
+        if (Stats.Events > EventsAtLastLog)
+        {
+            UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkLocalSink: %.0f events/s over the last %.0fs (%.0f/s since start)"),
+                (Stats.Events - EventsAtLastLog) / SplunkLocalSink::StatsLogInterval, SplunkLocalSink::StatsLogInterval, GetEventsPerSecond());
+        }
+        EventsAtLastLog = Stats.Events;
+        NextStatsLogTime = Now + SplunkLocalSink::StatsLogInterval;
+    }
+    return true;
+}
+
+const FString* FSplunkLocalSink::FindHeader(const FHttpServerRequest& Request, const TCHAR* Name) const
+{
+    // Header names are case-insensitive; the server keeps them as the client sent them
+    for (const TPair<FString, TArray<FString>>& Header : Request.Headers)
+    {
+        if (Header.Key.Equals(Name, ESearchCase::IgnoreCase) && Header.Value.Num() > 0)
+        {
+            return &Header.Value[0];
+        }
+    }
+    return nullptr;
+}
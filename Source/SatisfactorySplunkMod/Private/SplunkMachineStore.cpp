@@ -0,0 +1,185 @@
+#include "SplunkMachineStore.h"
+
+void FSplunkMachineRollup::Add(float InEfficiency, float InPower, float InRate)
+{
+    Machines++;
+    PowerConsumption += InPower;
+    ExtractionRate   += InRate;
+    if (InEfficiency > 0.0f)
+    {
+        Producing++;
+        TotalEfficiency += InEfficiency;
+        EfficiencyBuckets[FMath::Min((int32)(InEfficiency * NumEfficiencyBuckets), NumEfficiencyBuckets - 1)]++;
+    }
+}
+
+float FSplunkMachineRollup::GetEfficiencyPercentile(float Fraction) const
+{
+    if (Producing == 0) return 0.0f;
+
+    const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * Producing), 1, Producing);
+    int32 Seen = 0;
+    for (int32 Bucket = 0; Bucket < NumEfficiencyBuckets; Bucket++)
+    {
+        Seen += EfficiencyBuckets[Bucket];
+        if (Seen >= Rank)
+        {
+            return (Bucket + 1) / (float)NumEfficiencyBuckets;
+        }
+    }
+    return 1.0f;
+}
+
+FSplunkMachineRollup& FSplunkMachineRollup::operator+=(const FSplunkMachineRollup& Other)
+{
+    Machines         += Other.Machines;
+    Producing        += Other.Producing;
+    TotalEfficiency  += Other.TotalEfficiency;
+    PowerConsumption += Other.PowerConsumption;
+    ExtractionRate   += Other.ExtractionRate;
+    for (int32 i = 0; i < NumEfficiencyBuckets; i++)
+    {
+        EfficiencyBuckets[i] += Other.EfficiencyBuckets[i];
+    }
+    return *this;
+}
+
+void FSplunkMachineStore::BeginPass(int32 NumSlots)
+{
+    Pass++;
+    if (NumSlots > Stamps.Num())
+    {
+        Grow(NumSlots);
+    }
+}
+
+void FSplunkMachineStore::Write(int32 Slot, const FSplunkMachineReading& Reading)
+{
+    check(Slot >= 0);
+    if (Slot >= Stamps.Num())
+    {
+        Grow(Slot + 1);
+    }
+
+    Stamps[Slot]     = Pass;
+    Owners[Slot]     = Reading.NameId;
+    GroupIds[Slot]   = Reading.GroupId;
+    Keys[Slot]       = Reading.Key;
+    Power[Slot]      = Reading.Power;
+    MaxPower[Slot]   = Reading.MaxPower;
+    Efficiency[Slot] = Reading.Efficiency;
+    Rate[Slot]       = Reading.Rate;
+    Producing[Slot]  = Reading.bProducing;
+    FuelEnergy[Slot] = Reading.FuelEnergy;
+    FuelStacks[Slot] = Reading.FuelStacks;
+    Locations[Slot]  = Reading.Location;
+}
+
+FSplunkMachineReading FSplunkMachineStore::Read(int32 Slot) const
+{
+    FSplunkMachineReading Reading;
+    Reading.NameId     = Owners[Slot];
+    Reading.GroupId    = GroupIds[Slot];
+    Reading.Key        = Keys[Slot];
+    Reading.Power      = Power[Slot];
+    Reading.MaxPower   = MaxPower[Slot];
+    Reading.Efficiency = Efficiency[Slot];
+    Reading.Rate       = Rate[Slot];
+    Reading.bProducing = Producing[Slot];
+    Reading.FuelEnergy = FuelEnergy[Slot];
+    Reading.FuelStacks = FuelStacks[Slot];
+    Reading.Location   = Locations[Slot];
+    return Reading;
+}
+
+FSplunkMachineRollup FSplunkMachineStore::Rollup() const
+{
+    FSplunkMachineRollup Result;
+    const int32 Count = Stamps.Num();
+    const uint32* RESTRICT StampData = Stamps.GetData();
+    const float* RESTRICT PowerData = Power.GetData();
+    const float* RESTRICT EfficiencyData = Efficiency.GetData();
+    const float* RESTRICT RateData = Rate.GetData();
+
+    // Rows are masked rather than skipped so the sums stay straight-line code
+    int32 Machines = 0;
+    int32 NumProducing = 0;
+    float TotalEfficiency = 0.0f;
+    float TotalPower = 0.0f;
+    float TotalRate = 0.0f;
+    for (int32 i = 0; i < Count; i++)
+    {
+        const float Live = StampData[i] == Pass ? 1.0f : 0.0f;
+        const float Eff = EfficiencyData[i] * Live;
+        const int32 bProducing = Eff > 0.0f ? 1 : 0;
+
+        Machines        += (int32)Live;
+        NumProducing    += bProducing;
+        TotalEfficiency += Eff;
+        TotalPower      += PowerData[i] * Live;
+        TotalRate       += RateData[i] * Live;
+
+        const int32 Bucket = FMath::Min((int32)(Eff * FSplunkMachineRollup::NumEfficiencyBuckets), FSplunkMachineRollup::NumEfficiencyBuckets - 1);
+        Result.EfficiencyBuckets[Bucket] += bProducing;
+    }
+
+    Result.Machines         = Machines;
+    Result.Producing        = NumProducing;
+    Result.TotalEfficiency  = TotalEfficiency;
+    Result.PowerConsumption = TotalPower;
+    Result.ExtractionRate   = TotalRate;
+    return Result;
+}
+
+void FSplunkMachineStore::RollupGroups(TSplunkMetricGroups<FSplunkMachineRollup>& Groups) const
+{
+    // Machines of one class are often built in a row, so the map is only searched when the group changes
+    int32 LastGroup = INDEX_NONE;
+    FSplunkMachineRollup* Group = nullptr;
+    for (int32 i = 0; i < Stamps.Num(); i++)
+    {
+        if (Stamps[i] != Pass) continue;
+        if (!Group || GroupIds[i] != LastGroup)
+        {
+            LastGroup = GroupIds[i];
+            Group = &Groups.FindOrAdd(LastGroup);
+        }
+        Group->Add(Efficiency[i], Power[i], Rate[i]);
+    }
+}
+
+void FSplunkMachineStore::Reset()
+{
+    Stamps.Reset();
+    Owners.Reset();
+    GroupIds.Reset();
+    Keys.Reset();
+    Power.Reset();
+    MaxPower.Reset();
+    Efficiency.Reset();
+    Rate.Reset();
+    Producing.Reset();
+    FuelEnergy.Reset();
+    FuelStacks.Reset();
+    Locations.Reset();
+    Pass = 1;
+}
+
+void FSplunkMachineStore::Grow(int32 NewNum)
+{
+    // Slots are dense, so the columns only ever grow to the list's high-water mark
+    const int32 Added = NewNum - Stamps.Num();
+
+    Stamps.AddZeroed(Added);
+    Owners.AddZeroed(Added);
+    GroupIds.AddZeroed(Added);
+    Keys.AddZeroed(Added);
+    Power.AddZeroed(Added);
+    MaxPower.AddZeroed(Added);
+    Efficiency.AddZeroed(Added);
+    Rate.AddZeroed(Added);
+    Producing.AddZeroed(Added);
+    FuelEnergy.AddZeroed(Added);
+    FuelStacks.AddZeroed(Added);
+    Locations.AddZeroed(Added);
+}
@@ -0,0 +1,112 @@
+#include "SplunkNameCache.h"
+#include "Internationalization/Internationalization.h"
+
+FSplunkNameCache::FSplunkNameCache(FSplunkStringTable& InStrings)
+    : Strings(InStrings)
+{
+    CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddRaw(this, &FSplunkNameCache::OnCultureChanged);
+}
+
+FSplunkNameCache::~FSplunkNameCache()
+{
+    if (FInternationalization::IsAvailable())
+    {
+        FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+    }
+}
+
+int32 FSplunkNameCache::GetActorName(const AActor* Actor)
+{
+    const FName Name = Actor->GetFName();
+    if (const int32* Existing = ActorNames.Find(Name))
+    {
+        return *Existing;
+    }
+    return ActorNames.Add(Name, Strings.Add(Name.ToString()));
+}
+
+int32 FSplunkNameCache::GetClassName(const UClass* Class)
+{
+    if (const int32* Existing = ClassNames.Find(Class))
+    {
+        return *Existing;
+    }
+    return ClassNames.Add(Class, Strings.Add(Class->GetName()));
+}
+
+int32 FSplunkNameCache::GetItemName(const UClass* ItemClass)
+{
+    if (const int32* Existing = ItemNames.Find(ItemClass))
+    {
+        return *Existing;
+    }
+
+    const UFGItemDescriptor* ItemDesc = ItemClass ? ItemClass->GetDefaultObject<UFGItemDescriptor>() : nullptr;
+    const FString Name = ItemDesc ? ItemDesc->GetDisplayName().ToString() : FString();
+    return ItemNames.Add(ItemClass, Strings.Intern(Name));
+}
+
+int32 FSplunkNameCache::GetCircuitName(int32 CircuitId)
+{
+    if (const int32* Existing = CircuitNames.Find(CircuitId))
+    {
+        return *Existing;
+    }
+    return CircuitNames.Add(CircuitId, Strings.Intern(FString::FromInt(CircuitId)));
+}
+
+const FSplunkRecipeNames* FSplunkNameCache::GetRecipeNames(const AActor* Machine, TSubclassOf<UFGRecipe> Recipe)
+{
+    if (!Recipe) return nullptr;
+
+    FMachineRecipe& Entry = MachineRecipes.FindOrAdd(Machine->GetFName());
+    if (Entry.Recipe != Recipe || !Recipes.IsValidIndex(Entry.RecipeIndex))
+    {
+        // Recipe changed (or first sample): re-resolve
+        Entry.Recipe = Recipe;
+        Entry.RecipeIndex = GetRecipeIndex(Recipe);
+    }
+    return &Recipes[Entry.RecipeIndex];
+}
+
+int32 FSplunkNameCache::GetRecipeIndex(const UClass* RecipeClass)
+{
+    if (const int32* Existing = RecipeIndices.Find(RecipeClass))
+    {
+        return *Existing;
+    }
+
+    FSplunkRecipeNames Names;
+    if (UFGRecipe* Recipe = RecipeClass->GetDefaultObject<UFGRecipe>())
+    {
+        Names.RecipeNameId = Strings.Intern(Recipe->GetDisplayName().ToString());
+
+        for (const FItemAmount& Product : Recipe->GetProducts())
+        {
+            if (Product.ItemClass)
+            {
+                Names.Products.Add({ GetItemName(Product.ItemClass), Product.Amount });
+            }
+        }
+        for (const FItemAmount& Ingredient : Recipe->GetIngredients())
+        {
+            if (Ingredient.ItemClass)
+            {
+                Names.Ingredients.Add({ GetItemName(Ingredient.ItemClass), Ingredient.Amount });
+            }
+        }
+    }
+
+    const int32 Index = Recipes.Add(MoveTemp(Names));
+    RecipeIndices.Add(RecipeClass, Index);
+    return Index;
+}
+
+void FSplunkNameCache::OnCultureChanged()
+{
+    // Display names are localized; the next sample resolves them again in the new language
+    ItemNames.Reset();
+    RecipeIndices.Reset();
+    Recipes.Reset();
+    MachineRecipes.Reset();
+}
@@ -0,0 +1,449 @@
+#include "SplunkPipeline.h"
+#include "SatisfactorySplunkMod.h"
+#include "SplunkGzip.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeExit.h"
+
+namespace SplunkPipeline
+{
+    // How long the worker sleeps when nothing wakes it; bounds encode latency for small trickles
+    static constexpr uint32 IdleWaitMs = 5;
+
+    // Smallest ring a lane gets however small its share, so one event always fits
+    static constexpr int32 MinLaneCapacityBytes = 64 * 1024;
+
+    // Longest Submit() waits for the worker to make room in a full queue before dropping the event
+    static constexpr double MaxSubmitWaitSeconds = 0.1;
+}
+
+FSplunkPipeline::FSplunkPipeline(const FSplunkPipelineConfig& InConfig, FDispatchFunc InDispatch, FCanDispatchFunc InCanDispatch)
+    : Config(InConfig)
+    , Dispatch(MoveTemp(InDispatch))
+    , CanDispatch(MoveTemp(InCanDispatch))
+    , Queue(QueueSize)
+{
+    const double Now = FPlatformTime::Seconds();
+    for (int32 i = 0; i < (int32)ESplunkLane::Num; i++)
+    {
+        FLane& Lane = Lanes[i];
+        Lane.Config = Config.Lanes[i];
+        Lane.Config.Weight = FMath::Max(Lane.Config.Weight, 1);
+        Lane.Ring.SetCapacity(FMath::Max((int32)(Config.BufferCapacityBytes * Lane.Config.CapacityShare), SplunkPipeline::MinLaneCapacityBytes));
+        Lane.NextFlushTime = Now + Lane.Config.FlushInterval;
+    }
+}
+
+FSplunkPipeline::~FSplunkPipeline()
+{
+    Shutdown();
+}
+
+void FSplunkPipeline::Start()
+{
+    if (Thread || !FPlatformProcess::SupportsMultithreading()) return;
+
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Thread = FRunnableThread::Create(this, TEXT("SplunkPipeline"), 0, TPri_BelowNormal);
+    if (!Thread)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+        UE_LOG(LogSatisfactorySplunkMod, Warning, TEXT("SplunkPipeline: Could not start worker thread, encoding on the game thread"));
+    }
+}
+
+void FSplunkPipeline::Shutdown()
+{
+    if (!Thread)
+    {
+        Drain();
+        Flush(true);
+        return;
+    }
+
+    Stop();
+    WakeEvent->Trigger();
+    Thread->WaitForCompletion();
+    delete Thread;
+    Thread = nullptr;
+
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+}
+
+bool FSplunkPipeline::Submit(TArrayView<const FSplunkSample> Samples, ESplunkLane Lane, bool bEvictOldest)
+{
+    check(Samples.Num() > 0 && Samples.Last().Op == ESplunkSampleOp::EndEvent);
+
+    // Only whole events are queued, so the worker never sees half of one. We are the only
+    // producer, so free space can only grow between this check and the enqueues below.
+    uint32 Free = QueueSize - 1 - Queue.Count();
+    if (!Thread && (uint32)Samples.Num() > Free)
+    {
+        Drain();
+        Free = QueueSize - 1 - Queue.Count();
+    }
+    else if ((uint32)Samples.Num() > Free)
+    {
+        // A sweep without a frame budget can record faster than the worker drains. The queue is
+        // the worker's to consume, so wait for it instead of dropping an event the overflow
+        // policy never got to see; it empties the whole queue per wake-up.
+        SPLUNK_SCOPE("Splunk::SubmitWait", STAT_SplunkSubmitWait);
+        QueueWaits++;
+        const double GiveUpTime = FPlatformTime::Seconds() + SplunkPipeline::MaxSubmitWaitSeconds;
+        do
+        {
+            WakeEvent->Trigger();
+            FPlatformProcess::Yield();
+            Free = QueueSize - 1 - Queue.Count();
+        }
+        while ((uint32)Samples.Num() > Free && FPlatformTime::Seconds() < GiveUpTime);
+    }
+    if ((uint32)Samples.Num() > Free)
+    {
+        // Only if the worker is wedged, or the event is larger than the whole queue
+        QueueDroppedEvents++;
+        return false;
+    }
+
+    for (int32 i = 0; i < Samples.Num() - 1; i++)
+    {
+        Queue.Enqueue(Samples[i]);
+    }
+    FSplunkSample End = Samples.Last();
+    End.Int = ((int64)Lane << 1) | (bEvictOldest ? 1 : 0);
+    Queue.Enqueue(End);
+
+    if (Thread && Queue.Count() >= WakeThreshold)
+    {
+        WakeEvent->Trigger();
+    }
+    return true;
+}
+
+void FSplunkPipeline::RequestFlush()
+{
+    if (!Thread)
+    {
+        Drain();
+        ScheduleFlushes(true);
+        Flush(false);
+        return;
+    }
+
+    bFlushRequested = true;
+    WakeEvent->Trigger();
+}
+
+void FSplunkPipeline::RequestDispatch()
+{
+    if (!Thread)
+    {
+        Drain();
+        ScheduleFlushes(false);
+        Flush(false);
+        return;
+    }
+
+    WakeEvent->Trigger();
+}
+
+void FSplunkPipeline::SetAdaptiveFlush(int32 BatchBytes, float MaxAgeSeconds)
+{
+    AdaptiveBatchBytes.store(BatchBytes, std::memory_order_relaxed);
+    AdaptiveMaxAge.store(MaxAgeSeconds, std::memory_order_relaxed);
+}
+
+uint32 FSplunkPipeline::Run()
+{
+    while (!bStopping)
+    {
+        WakeEvent->Wait(SplunkPipeline::IdleWaitMs);
+        Drain();
+        ScheduleFlushes(bFlushRequested.exchange(false));
+        Flush(false);
+    }
+
+    // Whatever the game thread queued before Shutdown goes out now
+    Drain();
+    Flush(true);
+    return 0;
+}
+
+void FSplunkPipeline::Stop()
+{
+    bStopping = true;
+}
+
+void FSplunkPipeline::Drain()
+{
+    SPLUNK_SCOPE("Splunk::Encode", STAT_SplunkEncode);
+
+    const double StartTime = FPlatformTime::Seconds();
+    bool bAny = false;
+
+    FSplunkSample Sample;
+    while (Queue.Dequeue(Sample))
+    {
+        Decode(Sample);
+        bAny = true;
+    }
+
+    if (bAny)
+    {
+        EncodeMicros += (int64)((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+    }
+    PublishStats();
+}
+
+void FSplunkPipeline::ScheduleFlushes(bool bRequested)
+{
+    const double Now = FPlatformTime::Seconds();
+    const int32 AdaptiveBytes = AdaptiveBatchBytes.load(std::memory_order_relaxed);
+    const float AdaptiveAge = AdaptiveMaxAge.load(std::memory_order_relaxed);
+
+    for (FLane& Lane : Lanes)
+    {
+        bool bDue = Lane.Ring.GetUsedBytes() >= Lane.Config.MaxPayloadBytes;
+        if (Lane.Config.bAdaptive && AdaptiveBytes > 0)
+        {
+            bDue |= Lane.Ring.GetUsedBytes() >= AdaptiveBytes;
+            bDue |= !Lane.Ring.IsEmpty() && Now - Lane.OldestTime >= AdaptiveAge;
+        }
+        else if (Lane.Config.FlushInterval > 0.0f)
+        {
+            if (Now >= Lane.NextFlushTime)
+            {
+                Lane.NextFlushTime = Now + Lane.Config.FlushInterval;
+                bDue = true;
+            }
+        }
+        else
+        {
+            bDue |= bRequested;
+        }
+
+        if (bDue && !Lane.Ring.IsEmpty())
+        {
+            Lane.bFlushPending = true;
+        }
+    }
+}
+
+void FSplunkPipeline::Flush(bool bFinal)
+{
+    SPLUNK_SCOPE("Splunk::WorkerFlush", STAT_SplunkPipelineFlush);
+
+    // Leave the backlog in the rings while the sender is saturated; each lane's overflow policy bounds it
+    bool bSent = false;
+    while (bFinal || !CanDispatch || CanDispatch())
+    {
+        const int32 LaneIndex = PickLane(bFinal);
+        if (LaneIndex == INDEX_NONE) break;
+
+        SendBatch(Lanes[LaneIndex], LaneIndex);
+        bSent = true;
+    }
+
+    if (bSent)
+    {
+        PublishStats();
+    }
+}
+
+int32 FSplunkPipeline::PickLane(bool bFinal)
+{
+    // Smooth weighted round robin: every waiting lane earns its weight, the richest is served
+    // and pays the total. Ties go to the higher-priority lane.
+    int32 Best = INDEX_NONE;
+    int32 TotalWeight = 0;
+    for (int32 i = 0; i < (int32)ESplunkLane::Num; i++)
+    {
+        FLane& Lane = Lanes[i];
+        if (Lane.Ring.IsEmpty())
+        {
+            Lane.bFlushPending = false;
+            Lane.CurrentWeight = 0;
+            continue;
+        }
+        if (!bFinal && !Lane.bFlushPending) continue;
+
+        Lane.CurrentWeight += Lane.Config.Weight;
+        TotalWeight += Lane.Config.Weight;
+        if (Best == INDEX_NONE || Lane.CurrentWeight > Lanes[Best].CurrentWeight)
+        {
+            Best = i;
+        }
+    }
+
+    if (Best != INDEX_NONE)
+    {
+        Lanes[Best].CurrentWeight -= TotalWeight;
+    }
+    return Best;
+}
+
+void FSplunkPipeline::SendBatch(FLane& Lane, int32 LaneIndex)
+{
+    int32 MaxBytes = Lane.Config.MaxPayloadBytes;
+    const int32 AdaptiveBytes = AdaptiveBatchBytes.load(std::memory_order_relaxed);
+    if (Lane.Config.bAdaptive && AdaptiveBytes > 0)
+    {
+        MaxBytes = FMath::Min(MaxBytes, AdaptiveBytes);
+    }
+
+    TArray<uint8> Payload;
+    Payload.Reserve(FMath::Min(Lane.Ring.GetUsedBytes(), MaxBytes));
+    const int32 NumEvents = Lane.Ring.PopBatch(Payload, MaxBytes);
+
+    // A backlog keeps its first event's time, so it stays due until drained
+    if (Lane.Ring.IsEmpty())
+    {
+        Lane.OldestTime = 0.0;
+    }
+
+    PayloadBytes += Payload.Num();
+    LaneStats[LaneIndex].Batches++;
+
+    bool bGzipped = false;
+    if (Config.GzipCompressionLevel > 0 && Payload.Num() >= Config.GzipMinPayloadBytes)
+    {
+        SPLUNK_SCOPE("Splunk::Compress", STAT_SplunkCompress);
+        const double StartTime = FPlatformTime::Seconds();
+        ON_SCOPE_EXIT { CompressMicros += (int64)((FPlatformTime::Seconds() - StartTime) * 1000000.0); };
+
+        TArray<uint8> Compressed;
+        if (FSplunkGzip::Compress(Payload.GetData(), Payload.Num(), Config.GzipCompressionLevel, Compressed))
+        {
+            Payload = MoveTemp(Compressed);
+            bGzipped = true;
+        }
+        else
+        {
+            UE_LOG(LogSatisfactorySplunkMod, Warning, TEXT("SplunkPipeline: gzip failed, sending %d bytes uncompressed"), Payload.Num());
+        }
+    }
+
+    UE_LOG(LogSatisfactorySplunkMod, Log, TEXT("SplunkPipeline: Sending batch of %d %s events (%d bytes%s) to Splunk"),
+        NumEvents, GetLaneName((ESplunkLane)LaneIndex), Payload.Num(), bGzipped ? TEXT(", gzip") : TEXT(""));
+
+    DispatchedBytes += Payload.Num();
+    Dispatch(MoveTemp(Payload), bGzipped);
+}
+
+void FSplunkPipeline::Decode(const FSplunkSample& Sample)
+{
+    switch (Sample.Op)
+    {
+        case ESplunkSampleOp::BeginEvent:
+            Writer.BeginEvent(Sample.Int, Sample.Key);
+            break;
+
+        case ESplunkSampleOp::BeginMetricsEvent:
+            Writer.BeginMetricsEvent(Sample.Int);
+            break;
+
+        case ESplunkSampleOp::EndEvent:
+        {
+            Writer.EndEvent();
+            EncodedEvents++;
+            const int32 LaneIndex = FMath::Clamp((int32)(Sample.Int >> 1), 0, (int32)ESplunkLane::Num - 1);
+            if (Lanes[LaneIndex].Ring.IsEmpty())
+            {
+                Lanes[LaneIndex].OldestTime = FPlatformTime::Seconds();
+            }
+            Lanes[LaneIndex].Ring.Push(Writer.GetBuffer().GetData(), Writer.GetNumBytes(), Config.bEvictOldest || (Sample.Int & 1) != 0);
+            Writer.Reset();
+            break;
+        }
+
+        case ESplunkSampleOp::BeginObject:
+            if (Sample.Key.Bytes)
+            {
+                Writer.BeginObject(Sample.Key);
+            }
+            else
+            {
+                Writer.BeginObject();
+            }
+            break;
+
+        case ESplunkSampleOp::EndObject:
+            Writer.EndObject();
+            break;
+
+        case ESplunkSampleOp::BeginArray:
+            Writer.BeginArray(Sample.Key);
+            break;
+
+        case ESplunkSampleOp::EndArray:
+            Writer.EndArray();
+            break;
+
+        case ESplunkSampleOp::String:
+            Strings.Write(Writer, Sample.Key, Sample.StringId);
+            break;
+
+        case ESplunkSampleOp::Token:
+            Writer.WriteString(Sample.Key, FSplunkHECToken{ Sample.Token, Sample.TokenLen });
+            break;
+
+        case ESplunkSampleOp::Number:
+            Writer.WriteNumber(Sample.Key, Sample.Number);
+            break;
+
+        case ESplunkSampleOp::Int:
+            Writer.WriteInt(Sample.Key, Sample.Int);
+            break;
+
+        case ESplunkSampleOp::Bool:
+            Writer.WriteBool(Sample.Key, Sample.bValue);
+            break;
+    }
+}
+
+void FSplunkPipeline::PublishStats()
+{
+    int32 Events = 0;
+    int32 Bytes = 0;
+    int64 DroppedEvents = 0;
+    int64 DroppedBytes = 0;
+    for (int32 i = 0; i < (int32)ESplunkLane::Num; i++)
+    {
+        const FSplunkEventRing& Ring = Lanes[i].Ring;
+        LaneStats[i].BufferedEvents.store(Ring.Num(), std::memory_order_relaxed);
+        LaneStats[i].BufferedBytes.store(Ring.GetUsedBytes(), std::memory_order_relaxed);
+        LaneStats[i].DroppedEvents.store(Ring.GetDroppedEvents(), std::memory_order_relaxed);
+
+        Events        += Ring.Num();
+        Bytes         += Ring.GetUsedBytes();
+        DroppedEvents += Ring.GetDroppedEvents();
+        DroppedBytes  += Ring.GetDroppedBytes();
+    }
+
+    BufferedEvents.store(Events, std::memory_order_relaxed);
+    BufferedBytes.store(Bytes, std::memory_order_relaxed);
+    RingDroppedEvents.store(DroppedEvents, std::memory_order_relaxed);
+    RingDroppedBytes.store(DroppedBytes, std::memory_order_relaxed);
+}
+
+float FSplunkPipeline::GetLaneFillRatio(ESplunkLane Lane) const
+{
+    // Ring capacities are fixed at construction, so reading them from another thread is safe
+    const int32 Capacity = Lanes[(int32)Lane].Ring.GetCapacityBytes();
+    return Capacity > 0 ? (float)GetLaneStats(Lane).BufferedBytes.load(std::memory_order_relaxed) / Capacity : 0.0f;
+}
+
+const TCHAR* FSplunkPipeline::GetLaneName(ESplunkLane Lane)
+{
+    switch (Lane)
+    {
+        case ESplunkLane::Power:   return TEXT("power");
+        case ESplunkLane::Metrics: return TEXT("metrics");
+        case ESplunkLane::Events:  return TEXT("events");
+        case ESplunkLane::Bulk:    return TEXT("bulk");
+        default:                   return TEXT("unknown");
+    }
+}
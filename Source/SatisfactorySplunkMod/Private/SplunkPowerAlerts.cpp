@@ -0,0 +1,62 @@
+#include "SplunkPowerAlerts.h"
+
+void FSplunkPowerAlerts::Detect(TConstArrayView<FSplunkCircuitReading> Readings, TArray<FSplunkPowerAlertEvent>& Out)
+{
+    Generation++;
+
+    for (const FSplunkCircuitReading& Reading : Readings)
+    {
+        const bool bFuseTriggered = Reading.bFuseTriggered;
+        const bool bDraining      = Reading.bHasBatteries && Reading.BatteryInput < -DrainThresholdMW;
+        const bool bEmpty         = Reading.bHasBatteries && Reading.BatteryStored <= EmptyThresholdMWh
+                                    && Reading.Consumption > Reading.Production;
+
+        FState* State = States.Find(Reading.CircuitId);
+        if (!State)
+        {
+            States.Add(Reading.CircuitId, { bFuseTriggered, bDraining, bEmpty, Generation });
+            continue;
+        }
+        State->Generation = Generation;
+
+        auto Edge = [&Out, &Reading](bool& bWas, bool bIs, ESplunkPowerAlert Rising, TOptional<ESplunkPowerAlert> Falling)
+        {
+            if (bWas == bIs) return;
+            bWas = bIs;
+            if (bIs)
+            {
+                Out.Add({ Rising, Reading });
+            }
+            else if (Falling)
+            {
+                Out.Add({ *Falling, Reading });
+            }
+        };
+
+        // Order matters for readers: batteries run dry before the fuse goes
+        Edge(State->bDraining, bDraining, ESplunkPowerAlert::BatteryDraining, ESplunkPowerAlert::BatteryStable);
+        Edge(State->bEmpty, bEmpty, ESplunkPowerAlert::BatteryEmpty, {});
+        Edge(State->bFuseTriggered, bFuseTriggered, ESplunkPowerAlert::FuseTriggered, ESplunkPowerAlert::FuseReset);
+    }
+
+    for (auto It = States.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Generation != Generation)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+const TCHAR* FSplunkPowerAlerts::ToString(ESplunkPowerAlert Alert)
+{
+    switch (Alert)
+    {
+        case ESplunkPowerAlert::FuseTriggered:   return TEXT("fuse_triggered");
+        case ESplunkPowerAlert::FuseReset:       return TEXT("fuse_reset");
+        case ESplunkPowerAlert::BatteryDraining: return TEXT("battery_draining");
+        case ESplunkPowerAlert::BatteryStable:   return TEXT("battery_stable");
+        case ESplunkPowerAlert::BatteryEmpty:    return TEXT("battery_empty");
+    }
+    return TEXT("unknown");
+}
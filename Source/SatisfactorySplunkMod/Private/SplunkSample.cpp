@@ -0,0 +1,56 @@
+#include "SplunkSample.h"
+
+int32 FSplunkStringTable::Intern(const FString& Value)
+{
+    if (const int32* Existing = Ids.Find(Value))
+    {
+        return *Existing;
+    }
+
+    const int32 Id = Add(Value);
+    Ids.Add(Value, Id);
+    return Id;
+}
+
+int32 FSplunkStringTable::Add(const FString& Value)
+{
+    FScopeLock ScopeLock(&Lock);
+    const int32 Offset = Bytes.Num();
+    FSplunkHECWriter::Escape(*Value, Value.Len(), Bytes);
+    return Spans.Add(FSpan{ Offset, Bytes.Num() - Offset });
+}
+
+void FSplunkStringTable::Write(FSplunkHECWriter& Writer, FSplunkHECToken Key, int32 Id) const
+{
+    FScopeLock ScopeLock(&Lock);
+    const FSpan& Span = Spans[Id];
+    Writer.WriteEscapedString(Key, Bytes.GetData() + Span.Offset, Span.Len);
+}
+
+void FSplunkSampleWriter::BeginEvent(int64 UnixTime, FSplunkHECToken SourceType)
+{
+    Add(ESplunkSampleOp::BeginEvent, SourceType).Int = UnixTime;
+}
+
+void FSplunkSampleWriter::BeginMetricsEvent(int64 UnixTime)
+{
+    Add(ESplunkSampleOp::BeginMetricsEvent, FSplunkHECToken{ nullptr, 0 }).Int = UnixTime;
+}
+
+void FSplunkSampleWriter::EndEvent()
+{
+    Add(ESplunkSampleOp::EndEvent, FSplunkHECToken{ nullptr, 0 });
+}
+
+void FSplunkSampleWriter::WriteString(FSplunkHECToken Key, const FString& Value)
+{
+    check(Strings);
+    Add(ESplunkSampleOp::String, Key).StringId = Strings->Intern(Value);
+}
+
+void FSplunkSampleWriter::WriteString(FSplunkHECToken Key, FSplunkHECToken Value)
+{
+    FSplunkSample& Sample = Add(ESplunkSampleOp::Token, Key);
+    Sample.Token = Value.Bytes;
+    Sample.TokenLen = Value.Len;
+}
@@ -0,0 +1,54 @@
+#include "SplunkScheduler.h"
+
+static int64 GreatestCommonDivisor(int64 A, int64 B)
+{
+    while (B != 0)
+    {
+        const int64 Remainder = A % B;
+        A = B;
+        B = Remainder;
+    }
+    return A;
+}
+
+static int64 ToTicks(float Seconds)
+{
+    return FMath::Max<int64>(FMath::RoundToInt64(Seconds / FSplunkScheduler::Quantum), 1);
+}
+
+/** Spreads the entries of one kind (heavy or light) over their own common period. */
+static void SpreadPhases(TArray<FSplunkScheduleEntry>& Entries, bool bHeavy)
+{
+    int64 PeriodTicks = 0;
+    int32 Num = 0;
+    for (const FSplunkScheduleEntry& Entry : Entries)
+    {
+        if (Entry.bHeavy != bHeavy) continue;
+        const int64 Ticks = ToTicks(Entry.Interval);
+        PeriodTicks = PeriodTicks == 0 ? Ticks : GreatestCommonDivisor(PeriodTicks, Ticks);
+        Num++;
+    }
+    if (Num == 0) return;
+
+    // Heavy tasks start at the top of their slots; light ones sit halfway between, off the heavy frames
+    const int64 Offset = bHeavy ? 0 : 1;
+    int64 LastTicks = -1;
+    int32 Index = 0;
+    for (FSplunkScheduleEntry& Entry : Entries)
+    {
+        if (Entry.bHeavy != bHeavy) continue;
+
+        // Whole quanta, so phases stay on the same grid as the quantized intervals. With more tasks
+        // than quanta in the period, k * P / N would repeat; bump instead so no two share a phase
+        const int64 PhaseTicks = FMath::Max(PeriodTicks * (2 * Index + Offset) / (2 * Num), LastTicks + 1);
+        Entry.Phase = PhaseTicks * FSplunkScheduler::Quantum;
+        LastTicks = PhaseTicks;
+        Index++;
+    }
+}
+
+void FSplunkScheduler::AssignPhases(TArray<FSplunkScheduleEntry>& Entries)
+{
+    SpreadPhases(Entries, true);
+    SpreadPhases(Entries, false);
+}
@@ -0,0 +1,256 @@
+#include "SplunkSpool.h"
+#include "SatisfactorySplunkMod.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace SplunkSpool
+{
+    static constexpr uint32 RecordMagic = 0x314C5053; // "SPL1"
+    static constexpr uint32 FlagGzipped = 1 << 0;
+    static constexpr int64 HeaderBytes = 4 * sizeof(uint32);
+
+    // Segments are the eviction unit, so keep them small relative to the cap
+    static constexpr int64 MaxSegmentBytes = 4 * 1024 * 1024;
+    static constexpr int64 MinSegmentBytes = 64 * 1024;
+}
+
+FSplunkSpool::FSplunkSpool(const FString& InDirectory, int64 InMaxDiskBytes)
+    : Directory(InDirectory)
+    , MaxDiskBytes(FMath::Max<int64>(InMaxDiskBytes, SplunkSpool::MinSegmentBytes))
+{
+    SegmentBytes = FMath::Clamp<int64>(MaxDiskBytes / 8, SplunkSpool::MinSegmentBytes, SplunkSpool::MaxSegmentBytes);
+}
+
+void FSplunkSpool::Open()
+{
+    FScopeLock ScopeLock(&Lock);
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*Directory);
+
+    Segments.Reset();
+    TotalBytes = 0;
+
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *(Directory / TEXT("spool_*.seg")), true, false);
+    for (const FString& File : Files)
+    {
+        const FString SeqString = FPaths::GetBaseFilename(File).RightChop(6); // "spool_"
+        FSegment Segment;
+        Segment.Seq = FCString::Strtoui64(*SeqString, nullptr, 10);
+        Segment.Size = PlatformFile.FileSize(*GetSegmentPath(Segment.Seq));
+        if (Segment.Size <= 0)
+        {
+            PlatformFile.DeleteFile(*GetSegmentPath(Segment.Seq));
+            continue;
+        }
+        Segments.Add(Segment);
+        TotalBytes += Segment.Size;
+    }
+    Segments.Sort([](const FSegment& A, const FSegment& B) { return A.Seq < B.Seq; });
+
+    // Restore the replay position if it still points at the oldest segment
+    ReadOffset = 0;
+    TArray<uint8> CursorBytes;
+    if (Segments.Num() > 0 && FFileHelper::LoadFileToArray(CursorBytes, *GetCursorPath(), FILEREAD_Silent)
+        && CursorBytes.Num() == sizeof(uint64) + sizeof(int64))
+    {
+        uint64 CursorSeq = 0;
+        int64 CursorOffset = 0;
+        FMemory::Memcpy(&CursorSeq, CursorBytes.GetData(), sizeof(uint64));
+        FMemory::Memcpy(&CursorOffset, CursorBytes.GetData() + sizeof(uint64), sizeof(int64));
+        if (CursorSeq == Segments[0].Seq && CursorOffset >= 0 && CursorOffset <= Segments[0].Size)
+        {
+            ReadOffset = CursorOffset;
+        }
+    }
+
+    if (Segments.Num() > 0)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Log,
+            TEXT("SplunkSpool: Found %d segment(s), %lld bytes awaiting replay in %s"),
+            Segments.Num(), TotalBytes - ReadOffset, *Directory);
+    }
+}
+
+bool FSplunkSpool::Append(const TArray<uint8>& Payload, bool bGzipped)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const int64 RecordBytes = SplunkSpool::HeaderBytes + Payload.Num();
+    if (RecordBytes > MaxDiskBytes)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Warning,
+            TEXT("SplunkSpool: Batch of %d bytes exceeds the spool cap and was dropped"), Payload.Num());
+        return false;
+    }
+
+    // Oldest-first eviction to stay under the cap
+    while (Segments.Num() > 0 && TotalBytes + RecordBytes > MaxDiskBytes)
+    {
+        DeleteOldestSegment();
+        EvictedSegments++;
+    }
+
+    // Start a new segment when there is none or the current one is full
+    if (Segments.Num() == 0 || Segments.Last().Size + RecordBytes > SegmentBytes)
+    {
+        FSegment Segment;
+        Segment.Seq = Segments.Num() > 0 ? Segments.Last().Seq + 1 : 1;
+        Segments.Add(Segment);
+    }
+
+    FSegment& Target = Segments.Last();
+    TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*GetSegmentPath(Target.Seq), true));
+    if (!Handle)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Error, TEXT("SplunkSpool: Could not open %s for writing"), *GetSegmentPath(Target.Seq));
+        if (Target.Size == 0)
+        {
+            Segments.Pop(false);
+        }
+        return false;
+    }
+
+    const uint32 Header[4] = {
+        SplunkSpool::RecordMagic,
+        bGzipped ? SplunkSpool::FlagGzipped : 0u,
+        (uint32)Payload.Num(),
+        FCrc::MemCrc32(Payload.GetData(), Payload.Num())
+    };
+    const bool bWritten = Handle->Write(reinterpret_cast<const uint8*>(Header), sizeof(Header))
+        && Handle->Write(Payload.GetData(), Payload.Num());
+    Handle.Reset();
+
+    if (!bWritten)
+    {
+        UE_LOG(LogSatisfactorySplunkMod, Error, TEXT("SplunkSpool: Write to %s failed"), *GetSegmentPath(Target.Seq));
+        return false;
+    }
+
+    Target.Size += RecordBytes;
+    TotalBytes += RecordBytes;
+    AppendedRecords++;
+    return true;
+}
+
+bool FSplunkSpool::PeekOldest(TArray<uint8>& OutPayload, bool& bOutGzipped)
+{
+    FScopeLock ScopeLock(&Lock);
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    while (Segments.Num() > 0)
+    {
+        const FSegment& Oldest = Segments[0];
+        if (ReadOffset + SplunkSpool::HeaderBytes <= Oldest.Size)
+        {
+            TUniquePtr<IFileHandle> Handle(PlatformFile.OpenRead(*GetSegmentPath(Oldest.Seq)));
+            uint32 Header[4] = {};
+            if (Handle && Handle->Seek(ReadOffset) && Handle->Read(reinterpret_cast<uint8*>(Header), sizeof(Header))
+                && Header[0] == SplunkSpool::RecordMagic
+                && ReadOffset + SplunkSpool::HeaderBytes + Header[2] <= Oldest.Size)
+            {
+                OutPayload.SetNumUninitialized(Header[2]);
+                if (Handle->Read(OutPayload.GetData(), Header[2])
+                    && FCrc::MemCrc32(OutPayload.GetData(), OutPayload.Num()) == Header[3])
+                {
+                    bOutGzipped = (Header[1] & SplunkSpool::FlagGzipped) != 0;
+                    PeekedRecordBytes = SplunkSpool::HeaderBytes + Header[2];
+                    return true;
+                }
+            }
+
+            // Torn write or corruption (e.g. the game crashed mid-append): the rest of this segment is unusable
+            UE_LOG(LogSatisfactorySplunkMod, Warning,
+                TEXT("SplunkSpool: Discarding unreadable remainder of %s"), *GetSegmentPath(Oldest.Seq));
+        }
+
+        DeleteOldestSegment();
+    }
+
+    return false;
+}
+
+void FSplunkSpool::PopOldest()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (Segments.Num() == 0 || PeekedRecordBytes == 0) return;
+
+    ReadOffset += PeekedRecordBytes;
+    PeekedRecordBytes = 0;
+
+    if (ReadOffset >= Segments[0].Size)
+    {
+        DeleteOldestSegment();
+    }
+    else
+    {
+        SaveCursor();
+    }
+}
+
+bool FSplunkSpool::IsEmpty() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Segments.Num() == 0;
+}
+
+int64 FSplunkSpool::GetDiskBytes() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return TotalBytes;
+}
+
+int32 FSplunkSpool::GetEvictedSegments() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return EvictedSegments;
+}
+
+int32 FSplunkSpool::GetAppendedRecords() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return AppendedRecords;
+}
+
+FString FSplunkSpool::GetSegmentPath(uint64 Seq) const
+{
+    return Directory / FString::Printf(TEXT("spool_%010llu.seg"), Seq);
+}
+
+FString FSplunkSpool::GetCursorPath() const
+{
+    return Directory / TEXT("cursor.dat");
+}
+
+void FSplunkSpool::SaveCursor() const
+{
+    if (Segments.Num() == 0) return;
+
+    TArray<uint8> CursorBytes;
+    CursorBytes.SetNumUninitialized(sizeof(uint64) + sizeof(int64));
+    FMemory::Memcpy(CursorBytes.GetData(), &Segments[0].Seq, sizeof(uint64));
+    FMemory::Memcpy(CursorBytes.GetData() + sizeof(uint64), &ReadOffset, sizeof(int64));
+    FFileHelper::SaveArrayToFile(CursorBytes, *GetCursorPath());
+}
+
+void FSplunkSpool::DeleteOldestSegment()
+{
+    if (Segments.Num() == 0) return;
+
+    FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*GetSegmentPath(Segments[0].Seq));
+    TotalBytes -= Segments[0].Size;
+    Segments.RemoveAt(0, 1, false);
+
+    ReadOffset = 0;
+    PeekedRecordBytes = 0;
+    SaveCursor();
+    if (Segments.Num() == 0)
+    {
+        FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*GetCursorPath());
+    }
+}
@@ -3,12 +3,48 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSatisfactorySplunkMod, Log, All);
 
+// Unreal Insights: launch with -trace=cpu,counters,SplunkExporter
+UE_TRACE_CHANNEL_EXTERN(SplunkExporterChannel, SATISFACTORYSPLUNKMOD_API);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(SplunkBufferedEvents);
+TRACE_DECLARE_INT_COUNTER_EXTERN(SplunkBufferedBytes);
+TRACE_DECLARE_INT_COUNTER_EXTERN(SplunkRequestsInFlight);
+TRACE_DECLARE_INT_COUNTER_EXTERN(SplunkBytesInFlight);
+
+// In game: stat SplunkExporter
+DECLARE_STATS_GROUP(TEXT("SplunkExporter"), STATGROUP_SplunkExporter, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Metrics Pass - Read"),   STAT_SplunkMetricsRead,     STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Metrics Pass - Record"), STAT_SplunkMetricsRecord,   STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sweep Slice"),           STAT_SplunkSweepSlice,      STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Layout Export"),         STAT_SplunkLayout,          STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flush Timer"),           STAT_SplunkFlushTimer,      STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HTTP Response"),         STAT_SplunkHttpResponse,    STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Submit - Queue Full"),   STAT_SplunkSubmitWait,      STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Worker - Encode"),       STAT_SplunkEncode,          STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Worker - Flush"),        STAT_SplunkPipelineFlush,   STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Worker - Compress"),     STAT_SplunkCompress,        STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Buffered Events"),   STAT_SplunkBufferedEvents,   STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Buffered Bytes"),    STAT_SplunkBufferedBytes,    STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Requests In Flight"), STAT_SplunkRequestsInFlight, STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Bytes In Flight"),   STAT_SplunkBytesInFlight,    STATGROUP_SplunkExporter, SATISFACTORYSPLUNKMOD_API);
+
+/** Named CPU scope on the SplunkExporter trace channel that also feeds a `stat SplunkExporter` cycle counter. */
+#define SPLUNK_SCOPE(TraceName, StatId) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(TraceName, SplunkExporterChannel); \
+    SCOPE_CYCLE_COUNTER(StatId)
+
 class FSatisfactorySplunkModModule : public IModuleInterface
 {
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
-};
\ No newline at end of file
+};
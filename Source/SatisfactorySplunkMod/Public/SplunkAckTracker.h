@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SortedMap.h"
+
+/**
+ * Bookkeeping for HEC indexer acknowledgement (at-least-once delivery).
+ *
+ * With acknowledgement enabled on the token, a 2xx only means the batch was received;
+ * the response carries an ackId that turns true once the indexers have committed it.
+ * Batches are kept here until their ID is acked. Splunk forgets IDs when it restarts
+ * or drops an idle channel, so batches still unacked after a timeout are handed back
+ * to be resent, and may then arrive twice. Over the byte budget the oldest batches are
+ * forgotten instead: they were received and are the likeliest to be acked next, so
+ * resending them would mostly duplicate events. They are counted as evicted.
+ *
+ * Game-thread only.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkAckTracker
+{
+public:
+    struct FBatch
+    {
+        TArray<uint8> Body;
+        bool bGzipped = false;
+        double SentTime = 0.0;
+    };
+
+    explicit FSplunkAckTracker(int64 InMaxPendingBytes);
+
+    /** Reads "ackId" from an event POST response. False if the token doesn't have acknowledgement enabled. */
+    static bool ParseAckId(const FString& ResponseBody, int64& OutAckId);
+
+    /** Tracks a received batch, evicting the oldest while over the byte budget. */
+    void Add(int64 AckId, TArray<uint8>&& Body, bool bGzipped, double Now);
+
+    /** Builds {"acks":[...]} for the oldest pending IDs. False if nothing is pending. */
+    bool BuildPollRequest(TArray<uint8>& OutBody) const;
+
+    /** Releases every batch the /ack response reports as committed. @return number released */
+    int32 ApplyPollResponse(const FString& ResponseBody);
+
+    /** Removes batches unacked for longer than Timeout, and orphaned ones, for resending. */
+    void TakeExpired(double Now, double Timeout, TArray<FBatch>& OutBatches);
+
+    /** Removes everything still unacked, e.g. to spool it at shutdown. */
+    void TakeAll(TArray<FBatch>& OutBatches);
+
+    int32 Num() const { return Pending.Num() + Orphaned.Num(); }
+    int64 GetPendingBytes() const { return PendingBytes; }
+    int64 GetAckedTotal() const { return AckedTotal; }
+
+    /** Batches no longer tracked because the byte budget was full; not resent. */
+    int64 GetEvictedTotal() const { return EvictedTotal; }
+
+private:
+    static constexpr int32 MaxIdsPerPoll = 1000;
+
+    void Remove(int64 AckId, TArray<FBatch>* OutBatches);
+
+    // Ack IDs increase per channel, so the sorted map keeps them oldest-first
+    TSortedMap<int64, FBatch> Pending;
+
+    // Batches whose ID was handed out again after a Splunk restart; resent on the next expiry pass
+    TArray<FBatch> Orphaned;
+
+    int64 MaxPendingBytes = 0;
+    int64 PendingBytes = 0;
+    int64 AckedTotal = 0;
+    int64 EvictedTotal = 0;
+};
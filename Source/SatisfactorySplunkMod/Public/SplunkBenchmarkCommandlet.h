@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SplunkBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless benchmark of the exporter's hot paths against a synthetic factory.
+ *
+ *   UnrealEditor-Cmd FactoryGame -run=SplunkBenchmark -nullrhi -unattended
+ *       [-Manufacturers=10000] [-Extractors=2000] [-Generators=1000] [-Vehicles=500]
+ *       [-Trains=200] [-CarsPerTrain=8] [-Samples=10] [-ChangeRatio=0.1] [-Gzip=6]
+ *       [-Csv=<path>]
+ *
+ * Every collector is run in events mode, events mode with delta suppression and metrics
+ * mode. The synthetic factory is held as the readings the exporter's collectors produce, and
+ * is written with the exporter's own FSplunkEventEncoders and machine stores, recording
+ * through FSplunkSampleWriter and encoding through an inline FSplunkPipeline
+ * whose dispatch only counts bytes, so no network is needed. Reports game-thread record
+ * time, worker encode time, allocations and bytes produced per item.
+ *
+ * Before benchmarking, the registry's actor list is checked against a reference set over a
+ * random add/remove sequence; the commandlet returns 1 if it disagrees.
+ */
+UCLASS()
+class USplunkBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    USplunkBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
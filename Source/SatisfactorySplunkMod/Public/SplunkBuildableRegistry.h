@@ -0,0 +1,182 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+// Satisfactory includes
+#include "Buildables/FGBuildable.h"
+#include "Buildables/FGBuildableManufacturer.h"
+#include "Buildables/FGBuildableResourceExtractor.h"
+#include "Buildables/FGBuildablePowerGenerator.h"
+#include "FGWheeledVehicle.h"
+#include "FGTrain.h"
+#include "FGCharacterPlayer.h"
+
+#include "SplunkBuildableRegistry.generated.h"
+
+/**
+ * Contiguous list of weak actor handles with O(1) add and remove.
+ * Removal swaps the last handle into the freed index, so iteration order is not stable.
+ * Handles may still go stale between a destroy and its notification; always check Get().
+ *
+ * Each actor also gets a slot that stays fixed while it is listed, so per-actor state
+ * (FSplunkMachineStore rows, delta tracking) can live in flat arrays. Slots are dense:
+ * a removed actor's slot goes on a free list and is handed to the next actor added, so
+ * GetNumSlots() only exceeds Num() by the removals not yet refilled.
+ */
+template<typename ActorType>
+class TSplunkActorList
+{
+public:
+    void Add(ActorType* Actor)
+    {
+        const TObjectKey<AActor> Key(Actor);
+        if (!Actor || IndexOf.Contains(Key)) return;
+        IndexOf.Add(Key, Items.Num());
+        Items.Add(Actor);
+        Keys.Add(Key);
+        Slots.Add(FreeSlots.Num() > 0 ? FreeSlots.Pop(false) : NumSlots++);
+    }
+
+    bool Remove(const AActor* Actor)
+    {
+        int32 Index = INDEX_NONE;
+        if (!IndexOf.RemoveAndCopyValue(TObjectKey<AActor>(Actor), Index)) return false;
+
+        FreeSlots.Add(Slots[Index]);
+
+        const int32 LastIndex = Items.Num() - 1;
+        if (Index != LastIndex)
+        {
+            Items[Index] = Items[LastIndex];
+            Keys[Index] = Keys[LastIndex];
+            Slots[Index] = Slots[LastIndex];
+            IndexOf.Add(Keys[Index], Index);
+        }
+        Items.RemoveAt(LastIndex, 1, false);
+        Keys.RemoveAt(LastIndex, 1, false);
+        Slots.RemoveAt(LastIndex, 1, false);
+        return true;
+    }
+
+    void Reset()
+    {
+        Items.Reset();
+        Keys.Reset();
+        Slots.Reset();
+        FreeSlots.Reset();
+        IndexOf.Reset();
+        NumSlots = 0;
+    }
+
+    int32 Num() const { return Items.Num(); }
+    const TWeakObjectPtr<ActorType>& operator[](int32 Index) const { return Items[Index]; }
+
+    /** Slot of the actor at Index; fixed for as long as that actor is listed. */
+    int32 GetSlot(int32 Index) const { return Slots[Index]; }
+
+    /** One past the highest slot handed out so far; size per-slot arrays to this. */
+    int32 GetNumSlots() const { return NumSlots; }
+
+    /** True if Items, Keys, Slots and IndexOf agree; used by the benchmark commandlet's self-check. */
+    bool CheckInvariants() const
+    {
+        if (Keys.Num() != Items.Num() || Slots.Num() != Items.Num() || IndexOf.Num() != Items.Num()) return false;
+        if (Items.Num() + FreeSlots.Num() != NumSlots) return false;
+
+        TBitArray<> Used(false, NumSlots);
+        for (int32 i = 0; i < Keys.Num(); i++)
+        {
+            const int32* Index = IndexOf.Find(Keys[i]);
+            if (!Index || *Index != i) return false;
+            if (Items[i].IsValid() && TObjectKey<AActor>(Items[i].Get()) != Keys[i]) return false;
+            if (!Used.IsValidIndex(Slots[i]) || Used[Slots[i]]) return false;
+            Used[Slots[i]] = true;
+        }
+        for (int32 Slot : FreeSlots)
+        {
+            if (!Used.IsValidIndex(Slot) || Used[Slot]) return false;
+            Used[Slot] = true;
+        }
+        return true;
+    }
+
+    // Range-for support
+    auto begin() const { return Items.begin(); }
+    auto end() const { return Items.end(); }
+
+private:
+    TArray<TWeakObjectPtr<ActorType>> Items;
+    // Parallel to Items; needed to re-point IndexOf after a swap even if the moved handle went stale
+    TArray<TObjectKey<AActor>> Keys;
+    TMap<TObjectKey<AActor>, int32> IndexOf;
+
+    // Parallel to Items; moved along with the handle on a swap
+    TArray<int32> Slots;
+    TArray<int32> FreeSlots;
+    int32 NumSlots = 0;
+};
+
+/** A buildable was constructed (bAdded) or is being dismantled. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSplunkBuildableChanged, AFGBuildable* /*Buildable*/, bool /*bAdded*/);
+
+/**
+ * World-level registry of the actors the Splunk exporter samples.
+ *
+ * Replaces per-tick TActorIterator scans: the world is walked once when the exporter
+ * calls Build() from BeginPlay, after which the typed lists are kept current from the
+ * world's actor spawned / destroyed notifications (construction and dismantle).
+ * Collectors iterate only the list they need.
+ */
+UCLASS()
+class SATISFACTORYSPLUNKMOD_API USplunkBuildableRegistry : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static USplunkBuildableRegistry* Get(const UWorld* World);
+
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+
+    /** Walks the world once and subscribes to spawn/destroy notifications. Safe to call again. */
+    void Build();
+
+    bool IsBuilt() const { return bBuilt; }
+
+    const TSplunkActorList<AFGBuildableManufacturer>&      GetManufacturers() const { return Manufacturers; }
+    const TSplunkActorList<AFGBuildableResourceExtractor>& GetExtractors()    const { return Extractors; }
+    const TSplunkActorList<AFGBuildablePowerGenerator>&    GetGenerators()    const { return Generators; }
+    const TSplunkActorList<AFGWheeledVehicle>&             GetVehicles()      const { return Vehicles; }
+    const TSplunkActorList<AFGTrain>&                      GetTrains()        const { return Trains; }
+    const TSplunkActorList<AFGCharacterPlayer>&            GetPlayers()       const { return Players; }
+
+    /** Every AFGBuildable, including the machines above; for layout snapshots. */
+    const TSplunkActorList<AFGBuildable>&                  GetBuildables()    const { return Buildables; }
+
+    /** Fires for buildables added or removed after Build(); not for what was loaded from the save. */
+    FOnSplunkBuildableChanged& OnBuildableChanged() { return BuildableChanged; }
+
+private:
+    void HandleActorSpawned(AActor* Actor);
+    void HandleActorDestroyed(AActor* Actor);
+
+    void RegisterActor(AActor* Actor);
+    void UnregisterActor(AActor* Actor);
+
+    TSplunkActorList<AFGBuildableManufacturer>      Manufacturers;
+    TSplunkActorList<AFGBuildableResourceExtractor> Extractors;
+    TSplunkActorList<AFGBuildablePowerGenerator>    Generators;
+    TSplunkActorList<AFGWheeledVehicle>             Vehicles;
+    TSplunkActorList<AFGTrain>                      Trains;
+    TSplunkActorList<AFGCharacterPlayer>            Players;
+    TSplunkActorList<AFGBuildable>                  Buildables;
+
+    FOnSplunkBuildableChanged BuildableChanged;
+
+    FDelegateHandle ActorSpawnedHandle;
+    FDelegateHandle ActorDestroyedHandle;
+    bool bBuilt = false;
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "FGPowerCircuit.h"
+
+class USplunkBuildableRegistry;
+class FSplunkNameCache;
+class AFGBuildable;
+class AFGCircuitSubsystem;
+
+/** One power circuit as read from the game, plus its cached building membership. */
+struct FSplunkCircuitReading
+{
+    int32 CircuitId = INDEX_NONE;
+    int32 NameId = INDEX_NONE;      // circuit ID as a string table entry
+
+    float Production = 0.0f;
+    float Consumption = 0.0f;
+    float Capacity = 0.0f;          // what the generators could produce
+    float MaxConsumption = 0.0f;    // what the consumers could draw
+
+    bool bHasBatteries = false;
+    float BatteryStored = 0.0f;     // MWh
+    float BatteryCapacity = 0.0f;   // MWh
+    float BatteryInput = 0.0f;      // MW, negative while draining
+    float TimeToBatteriesEmpty = 0.0f;
+    float TimeToBatteriesFull = 0.0f;
+
+    bool bFuseTriggered = false;
+
+    int32 Generators = 0;
+    int32 Consumers = 0;
+};
+
+/**
+ * Power circuits of one world, read from UFGPowerCircuit's own totals.
+ *
+ * Which circuits exist and how many generators/consumers each has is worked out from the
+ * registry's buildables and cached. After that a Read() is O(circuits). Working it out walks
+ * every building, so it is resumable: AdvanceRebuild() fills a fresh list up to a deadline
+ * and only replaces the cached one when the walk completes, so Read() keeps serving the old
+ * membership meanwhile. A rebuild is due when MarkDirty() was called (a building with power
+ * info was built or dismantled), when a cached circuit has gone away (grids merged or split),
+ * and every RefreshSeconds to catch power switches, which change circuits without building
+ * anything.
+ *
+ * Game-thread only.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkCircuitCache
+{
+public:
+    static constexpr double RefreshSeconds = 30.0;
+
+    void MarkDirty() { bDirty = true; }
+
+    /** True if the membership should be rebuilt; the caller then drives AdvanceRebuild() from Cursor 0. */
+    bool IsStale() const { return bDirty || FPlatformTime::Seconds() >= NextRefreshTime; }
+
+    /**
+     * Walks buildables from Cursor until Deadline. Cursor 0 starts a fresh rebuild.
+     * Returns true once the walk is done and its list has replaced the cached one.
+     */
+    bool AdvanceRebuild(UWorld* World, const USplunkBuildableRegistry& Registry, FSplunkNameCache& Names, int32& Cursor, double Deadline);
+
+    /** Fills Out with every cached circuit that still exists. Never rebuilds; empty until the first rebuild completes. */
+    void Read(TArray<FSplunkCircuitReading>& Out);
+
+    void Reset();
+
+    int64 GetRebuildCount() const { return RebuildCount; }
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<UFGPowerCircuit> Circuit;
+        int32 CircuitId;
+        int32 NameId;
+        int32 Generators;
+        int32 Consumers;
+    };
+
+    void AddMember(const AFGBuildable* Building, AFGCircuitSubsystem& Subsystem, FSplunkNameCache& Names);
+
+    TArray<FEntry> Entries;
+
+    // The rebuild in progress; swapped into Entries when its walk completes
+    TArray<FEntry> PendingEntries;
+    TMap<int32, int32> PendingIndexOf;
+
+    bool bDirty = true;
+    double NextRefreshTime = 0.0;
+    int64 RebuildCount = 0;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSplunkMachineStore;
+
+/**
+ * Last-sent state per machine for events-mode change detection.
+ *
+ * One tracker follows one FSplunkMachineStore and is indexed by the same dense slots, so
+ * state is a flat array rather than a map. Each entry holds the readings last sent plus
+ * the row's identity key (recipe, resource type...) and owner; a change of either forces
+ * a send, so a slot handed to a newly built machine always starts with an event.
+ *
+ * Game-thread only.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkDeltaTracker
+{
+public:
+    /** A reading has changed when it moves by more than Epsilon * max(|last sent|, 1). */
+    void SetEpsilon(float InEpsilon) { Epsilon = FMath::Max(InEpsilon, 0.0f); }
+
+    /**
+     * Decides whether the machine in Store's Slot needs an event and, if so, records its row as last sent.
+     * Fuel and location ride along with an event but never trigger one.
+     * @param bForce  keyframe: always send and refresh the stored state
+     * @return true if the event should be sent
+     */
+    bool Update(const FSplunkMachineStore& Store, int32 Slot, bool bForce);
+
+    void Reset() { States.Reset(); }
+
+    int64 GetSentTotal() const { return SentTotal; }
+    int64 GetSuppressedTotal() const { return SuppressedTotal; }
+
+private:
+    struct FState
+    {
+        int32 Owner;
+        uint64 Key;
+        float Power;
+        float MaxPower;
+        float Efficiency;
+        float Rate;
+        bool bProducing;
+        bool bSent;
+    };
+
+    bool HasMoved(float Value, float Last) const
+    {
+        return FMath::Abs(Value - Last) > Epsilon * FMath::Max(FMath::Abs(Last), 1.0f);
+    }
+
+    TArray<FState> States;
+    float Epsilon = 0.01f;
+
+    int64 SentTotal = 0;
+    int64 SuppressedTotal = 0;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "SplunkSample.h"
+#include "SplunkMachineStore.h"
+#include "SplunkMetricGroups.h"
+
+struct FSplunkRecipeNames;
+class FSplunkDeltaTracker;
+
+/** One inventory stack as written into vehicle and train events. */
+struct FSplunkItemStack
+{
+    int32 NameId = INDEX_NONE;
+    int32 Quantity = 0;
+    float Value = 0.0f;     // energy per item for fuel, total weight for cargo
+};
+
+/** What a wheeled vehicle event reports, read off the actor beforehand. */
+struct FSplunkVehicleReading
+{
+    int32 NameId = INDEX_NONE;
+    const TCHAR* VehicleType = TEXT("Unknown");
+    bool bElectric = false;
+    bool bPlayerDriven = false;
+    bool bAutomated = false;
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float Speed = 0.0f;
+    float MaxSpeed = 0.0f;
+
+    int32 DriverNameId = INDEX_NONE;    // player-driven only
+    int32 PlayerId = INDEX_NONE;
+
+    bool bHasFuelInventory = false;
+    int32 FuelSlots = 0;
+    TArray<FSplunkItemStack> FuelItems;
+
+    bool bHasStorage = false;
+    int32 CargoSlots = 0;
+    TArray<FSplunkItemStack> Cargo;
+
+    int32 TargetStationId = INDEX_NONE; // automated only
+    float DistanceToTarget = 0.0f;
+
+    void Reset();
+};
+
+/** One car of a train; its cargo is a range of FSplunkTrainReading::Cargo. */
+struct FSplunkTrainCar
+{
+    int32 Index = 0;        // position in the consist, counting cars that could not be read
+    int32 NameId = INDEX_NONE;
+    FVector Location = FVector::ZeroVector;
+    bool bLocomotive = false;
+    bool bFreight = false;
+
+    float PowerConsumption = 0.0f;  // locomotives
+    float FuelPercentage = -1.0f;   // locomotives with a fuel inventory, else < 0
+
+    int32 CargoSlots = -1;          // freight wagons with an inventory, else < 0
+    int32 CargoBegin = 0;
+    int32 CargoNum = 0;
+};
+
+/** What a train event reports, read off the actor beforehand. */
+struct FSplunkTrainReading
+{
+    int32 NameId = INDEX_NONE;
+    float Speed = 0.0f;
+    bool bPlayerDriven = false;
+    int32 ConsistNum = 0;
+    TArray<FSplunkTrainCar> Cars;
+    TArray<FSplunkItemStack> Cargo;
+
+    bool bHasTimeTable = false;
+    int32 TimeTableStations = 0;
+    int32 CurrentStop = INDEX_NONE;
+    FString CurrentStation;         // empty if the current stop has no station
+
+    void Reset();
+};
+
+/**
+ * Field layouts of the per-entity events and the production metrics, shared by the exporter
+ * and the benchmark commandlet so the benchmark measures the events that are actually sent.
+ *
+ * Inputs are stored rows and readings, never actors; callers read actors first. Each Write*Event
+ * records one event up to its closing EndObject() and leaves committing it to the caller; the
+ * metrics writers record several events and call Commit after each.
+ */
+struct SATISFACTORYSPLUNKMOD_API FSplunkEventEncoders
+{
+    /**
+     * Machine events are encoded from Store's row at Slot.
+     * @param Deltas  delta mode tracker for Store, or nullptr to always send
+     * @return false if delta mode suppressed the event; nothing was recorded then
+     */
+    static bool WriteManufacturerEvent(FSplunkSampleWriter& Writer, const FSplunkMachineStore& Store, int32 Slot,
+        const FSplunkRecipeNames* Recipe, FSplunkDeltaTracker* Deltas, int64 Time, bool bKeyframe);
+    static bool WriteExtractorEvent(FSplunkSampleWriter& Writer, const FSplunkMachineStore& Store, int32 Slot,
+        FSplunkDeltaTracker* Deltas, int64 Time, bool bKeyframe);
+    static bool WriteGeneratorEvent(FSplunkSampleWriter& Writer, const FSplunkMachineStore& Store, int32 Slot,
+        FSplunkDeltaTracker* Deltas, int64 Time, bool bKeyframe);
+
+    static void WriteVehicleEvent(FSplunkSampleWriter& Writer, const FSplunkVehicleReading& Vehicle, int64 Time);
+    static void WriteTrainEvent(FSplunkSampleWriter& Writer, const FSplunkTrainReading& Train, int64 Time);
+
+    /** Production totals, then one event per machine class and per resource group. */
+    static void WriteProductionMetrics(FSplunkSampleWriter& Writer, int64 Time,
+        const FSplunkMachineRollup& Manufacturers, const FSplunkMachineRollup& Extractors,
+        const TSplunkMetricGroups<FSplunkMachineRollup>& Classes, const TSplunkMetricGroups<FSplunkMachineRollup>& Resources,
+        TFunctionRef<void()> Commit);
+
+    /** Writes a dimension field from a name ID, or "_other" for a metric group's overflow. */
+    static void WriteDimension(FSplunkSampleWriter& Writer, FSplunkHECToken Key, int32 NameId);
+};
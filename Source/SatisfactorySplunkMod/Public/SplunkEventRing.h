@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-capacity FIFO of encoded HEC events.
+ *
+ * The whole budget is allocated once; events are stored back to back as
+ * [Length u32][bytes] records and may wrap around the end of the storage.
+ * When an event does not fit the caller decides what to give up: the new event
+ * (Push returns false) or the oldest ones (bEvictOldest). Everything dropped is
+ * counted so it can be reported.
+ *
+ * Not thread-safe.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkEventRing
+{
+public:
+    explicit FSplunkEventRing(int32 InCapacityBytes = 0);
+
+    /** Reallocates to a new budget. Drops buffered events. */
+    void SetCapacity(int32 InCapacityBytes);
+
+    /**
+     * Adds one encoded event.
+     * @param bEvictOldest  make room by dropping the oldest events instead of refusing this one
+     * @return false if the event was dropped
+     */
+    bool Push(const uint8* Data, int32 Len, bool bEvictOldest);
+
+    /**
+     * Moves whole events from the front into Out (appended) until either limit would be exceeded.
+     * At least one event is moved if any are buffered, even if it alone exceeds MaxBytes.
+     * @return number of events moved
+     */
+    int32 PopBatch(TArray<uint8>& Out, int32 MaxBytes, int32 MaxEvents = MAX_int32);
+
+    int32 Num() const { return NumEvents; }
+    bool IsEmpty() const { return NumEvents == 0; }
+    int32 GetUsedBytes() const { return UsedBytes; }
+    int32 GetCapacityBytes() const { return Storage.Num(); }
+    float GetFillRatio() const { return Storage.Num() > 0 ? (float)UsedBytes / Storage.Num() : 0.0f; }
+
+    int64 GetDroppedEvents() const { return DroppedEvents; }
+    int64 GetDroppedBytes() const { return DroppedBytes; }
+
+private:
+    static constexpr int32 HeaderBytes = sizeof(uint32);
+
+    void DropOldest();
+    void Write(int32 Offset, const uint8* Data, int32 Len);
+    void Read(int32 Offset, uint8* Data, int32 Len) const;
+    int32 Wrap(int32 Offset) const { return Offset >= Storage.Num() ? Offset - Storage.Num() : Offset; }
+
+    TArray<uint8> Storage;
+    int32 Head = 0;         // offset of the oldest record
+    int32 UsedBytes = 0;
+    int32 NumEvents = 0;
+
+    int64 DroppedEvents = 0;
+    int64 DroppedBytes = 0;
+};
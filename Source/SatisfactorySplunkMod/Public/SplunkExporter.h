@@ -4,10 +4,6 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Http.h"
-#include "Json.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
 #include "TimerManager.h"
 
 // Satisfactory includes
@@ -36,8 +32,49 @@
 #include "GameFramework/CharacterMovementComponent.h"
 
 #include "SplunkModSettings.h"
+#include "SplunkHECWriter.h"
+#include "SplunkSpool.h"
+#include "SplunkPipeline.h"
+#include "SplunkNameCache.h"
+#include "SplunkDeltaTracker.h"
+#include "SplunkMetricGroups.h"
+#include "SplunkLocalSink.h"
+#include "SplunkScheduler.h"
+#include "SplunkHttpSender.h"
+#include "SplunkAckTracker.h"
+#include "SplunkHistogram.h"
+#include "SplunkCircuitCache.h"
+#include "SplunkPowerAlerts.h"
+#include "SplunkFlushController.h"
+#include "SplunkMachineStore.h"
+#include "SplunkEventEncoders.h"
 #include "SplunkExporter.generated.h"
 
+class USplunkBuildableRegistry;
+
+/** One resumable pass over a registry list. Circuits rebuilds circuit membership and runs in both modes. */
+enum class ESplunkSweep : uint8
+{
+    Manufacturers,
+    Extractors,
+    Generators,
+    Vehicles,
+    Trains,
+    Players,
+    Layout,
+    Circuits,
+    Num
+};
+
+/** Metrics-mode aggregators. Each has its own timer and its own pass. */
+enum class ESplunkMetrics : uint8
+{
+    Power,
+    Production,
+    Vehicles,
+    Players
+};
+
 UCLASS(BlueprintType, Blueprintable)
 class SATISFACTORYSPLUNKMOD_API ASplunkExporter : public AActor
 {
@@ -49,6 +86,7 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Tick(float DeltaSeconds) override;
 
 public:
     UFUNCTION(BlueprintCallable, Category = "Splunk Exporter")
@@ -66,40 +104,161 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Splunk Exporter")
     void LoadSettingsFromConfig();
 
+    /** Periodic tasks of the running collection with their phase offsets; empty when stopped. */
+    UFUNCTION(BlueprintCallable, Category = "Splunk Exporter")
+    TArray<FSplunkScheduleEntry> GetCollectionSchedule() const { return Schedule; }
+
 private:
     // ---------------------------------------------------------------
     // Metrics mode collectors (aggregated totals)
+    //
+    // Each timer runs its aggregator's own pass, in the phase slot the
+    // scheduler gave it. Power reads circuit totals, O(circuits), so
+    // no walk is shared between aggregators.
+    // Power and production also emit one multi-metric event per
+    // circuit / machine class / resource, with that as a dimension.
     // ---------------------------------------------------------------
-    void CollectPowerMetrics();
-    void CollectProductionMetrics();
-    void CollectVehicleMetrics();
-    void CollectPlayerMetrics();
+    struct FMetricsTotals
+    {
+        float PowerConsumption = 0.0f;
+        float PowerProduction = 0.0f;
+        float PowerCapacity = 0.0f;
+        float BatteryStored = 0.0f;
+        float BatteryCapacity = 0.0f;
+        int32 FusesTriggered = 0;
+        int32 GeneratorCount = 0;
+        FSplunkMachineRollup Manufacturers;
+        FSplunkMachineRollup Extractors;
+    };
+
+    // Normally one circuit per group; sums only when circuits overflow into "_other"
+    struct FCircuitMetrics
+    {
+        float Consumption = 0.0f;
+        float Production = 0.0f;
+        float Capacity = 0.0f;
+        float MaxConsumption = 0.0f;
+        float BatteryStored = 0.0f;
+        float BatteryCapacity = 0.0f;
+        float BatteryInput = 0.0f;
+        int32 FusesTriggered = 0;
+        int32 Generators = 0;
+        int32 Consumers = 0;
+
+        void Add(const FSplunkCircuitReading& Reading)
+        {
+            Consumption     += Reading.Consumption;
+            Production      += Reading.Production;
+            Capacity        += Reading.Capacity;
+            MaxConsumption  += Reading.MaxConsumption;
+            BatteryStored   += Reading.BatteryStored;
+            BatteryCapacity += Reading.BatteryCapacity;
+            BatteryInput    += Reading.BatteryInput;
+            FusesTriggered  += Reading.bFuseTriggered ? 1 : 0;
+            Generators      += Reading.Generators;
+            Consumers       += Reading.Consumers;
+        }
+    };
+
+    void CollectMetrics(ESplunkMetrics Kind);
+    void WritePowerMetrics(const FMetricsTotals& Totals, int64 Time);
+    void WriteProductionMetrics(const FMetricsTotals& Totals, int64 Time);
 
     // ---------------------------------------------------------------
     // Events mode collectors (detailed per-machine data)
+    //
+    // The Collect* functions only start sweeps; Tick advances them a
+    // few actors at a time within CollectorFrameBudgetMs per frame.
     // ---------------------------------------------------------------
+    struct FCollectorSweep
+    {
+        bool bActive = false;
+        int32 Cursor = 0;   // next index into the registry list
+        int64 Time = 0;     // all events of one sweep share the time it started
+        bool bKeyframe = true;
+        int64 NextKeyframeTime = 0;
+
+        // Layout only: the page being filled. Its Time doubles as the snapshot ID.
+        int32 Page = 0;
+        int32 PageFill = 0;
+    };
+
     void CollectProductionData();
     void CollectPowerData();
     void CollectAllVehicleData();
-    void CollectPersonalVehicles();
-    void CollectAutomatedVehicles();
-    void CollectTrainData();
     void CollectPlayerMovementSystems();
     void CollectFactoryLayoutData();
 
+    void BeginSweep(ESplunkSweep Kind);
+    void AdvanceSweeps(double Deadline);
+    bool AdvanceSweep(ESplunkSweep Kind, FCollectorSweep& Sweep, const USplunkBuildableRegistry& Registry, double Deadline);
+
+    // Machine events are skipped in delta mode unless changed or bKeyframe. Slot is the registry slot,
+    // which is also the machine's row in its store
+    void WriteManufacturerEvent(AFGBuildableManufacturer* Manufacturer, int32 Slot, int64 Time, bool bKeyframe);
+    void WriteExtractorEvent(AFGBuildableResourceExtractor* Extractor, int32 Slot, int64 Time, bool bKeyframe);
+    void WriteGeneratorEvent(AFGBuildablePowerGenerator* Generator, int32 Slot, int64 Time, bool bKeyframe);
+    void WriteVehicleEvent(AFGWheeledVehicle* Vehicle, int64 Time);
+    void WriteTrainEvent(AFGTrain* Train, int64 Time);
+    void WritePlayerEvent(AFGCharacterPlayer* Player, int64 Time);
+
+    // Power circuits are few, so they are written in one go with the generator sweep's first slice
+    void WriteCircuitEvents(int64 Time);
+
+    /** Starts the Circuits sweep if membership is stale; the current readings keep the old membership until it ends. */
+    void RefreshCircuits();
+
+    /** Fast lane: sends fuse and battery edges straight to HEC, bypassing the pipeline's buffer. */
+    void CheckPowerAlerts();
+
+    // Layout snapshots are paged: buildings are appended to the open page, which is submitted once full
+    void WriteLayoutBuilding(AFGBuildable* Building, FCollectorSweep& Sweep);
+    void BeginLayoutPage(FCollectorSweep& Sweep);
+    void EndLayoutPage(FCollectorSweep& Sweep, bool bLastPage);
+
+    /** Change feed: one event per building constructed or dismantled between snapshots. */
+    void OnBuildableChanged(AFGBuildable* Building, bool bAdded);
+
+    /** Marks this frame as used by a heavy collector; false if one already ran this frame. */
+    bool ClaimCollectorFrame();
+
     // Buffer flush (shared by both modes)
     void CheckAndFlushBuffer();
 
+    /** Updates the `stat SplunkExporter` and Insights counters for buffer depth and bytes in flight. */
+    void PublishProfilerCounters();
+
+    // Send buffer / backpressure
+    void CommitEvent(ESplunkLane Lane, bool bEvictOldest = false);
+    void UpdateBackpressure();
+
+    /** The collector a data type's timer calls in the current mode. */
+    FTimerDelegate MakeCollectorDelegate(ESplunkMetrics Kind);
+
+    /** Points the running timers at the current mode's collectors, keeping their phases and all collected state. */
+    void RebindCollectors();
+    void EmitBufferMetrics();
+    void EmitTimingMetrics();
+    void WriteTimingEvent(int64 Time, FSplunkHECToken Collector, FSplunkHistogram& Histogram);
+    bool IsMetricsModeActive() const { return bUseMetricsMode || bDegradedToMetrics; }
+
     // HTTP
-    void SendDataToSplunk(const FString& JsonData);
-    void SendLayoutDataToSplunk(TSharedPtr<FJsonObject> LayoutData);
+    void DispatchRequest(TArray<uint8>&& Body, bool bGzipped);
     void OnHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
+    // Disk spool
+    void ServiceSpool();
+    void OnSplunkUnavailable(FHttpRequestPtr Request, bool bIsReplay);
+    void OnSplunkAvailable();
+
+    // Indexer acknowledgement
+    void TrackAck(FHttpRequestPtr Request, FHttpResponsePtr Response);
+    void PollAcks();
+    void OnAckPollResponse(FHttpResponsePtr Response, bool bWasSuccessful);
+    FString GetAckURL() const;
+
     // Utilities
-    FString GetVehicleTypeFromClass(const FString& ClassName);
-    void AddEventToBuffer(TSharedPtr<FJsonObject> EventObject);
-    TSharedPtr<FJsonObject> CreateBaseEvent(const FString& SourceType);
-    TSharedPtr<FJsonObject> CreateMetricsEvent();
+    static int64 GetEventTime();
 
 private:
     // One independent timer per data type + one flush timer
@@ -107,10 +266,74 @@ private:
     FTimerHandle ProductionTimer;
     FTimerHandle VehicleTimer;
     FTimerHandle PlayerTimer;
+    FTimerHandle LayoutTimer;
     FTimerHandle BufferFlushTimer;
+    FTimerHandle PowerAlertTimer;
+
+    // Timers in start order with their phases, as built by FSplunkScheduler
+    TArray<FSplunkScheduleEntry> Schedule;
+
+    // Last frame a heavy collector (metrics pass or unbudgeted sweep) ran; one per frame.
+    // Budgeted slices don't claim it, so they never make a metrics pass wait.
+    uint64 HeavyCollectorFrame = 0;
+
+    FCollectorSweep Sweeps[(int32)ESplunkSweep::Num];
+    int32 NextSweepIndex = 0;
+
+    // Records one event at a time as POD samples; CommitEvent submits them to the pipeline
+    FSplunkSampleWriter EventWriter;
 
-    // Data buffer
-    TArray<TSharedPtr<FJsonObject>> DataBuffer;
+    // Holds the open layout page across frames, while EventWriter is shared by the other sweeps
+    FSplunkSampleWriter LayoutWriter;
+
+    // Worker that encodes, buffers, batches, compresses and dispatches submitted events
+    TUniquePtr<FSplunkPipeline> Pipeline;
+
+    // Bounded pool of in-flight HEC requests, shared by the pipeline and spool replay
+    TSharedPtr<FSplunkHttpSender, ESPMode::ThreadSafe> Sender;
+
+    // Actor/class/item/recipe names as string table IDs; only valid while Pipeline is
+    TUniquePtr<FSplunkNameCache> Names;
+
+    // Game-thread wall time per collector invocation (us), reset after every report.
+    // Sweep slices are timed per frame, which is what a hitch would show.
+    FSplunkHistogram MetricsPassTiming;
+    FSplunkHistogram SweepTimings[(int32)ESplunkSweep::Num];
+
+    // HTTP responses by status code since startup; 0 = network error
+    TMap<int32, int64> HttpStatusCounts;
+
+    // Machine readings, one column per field and one store per registry list, indexed by registry slot.
+    // Written by both the metrics pass and the events sweeps.
+    FSplunkMachineStore MachineStores[(int32)ESplunkMachineKind::Num];
+
+    // Last-sent machine readings for delta mode, one per store
+    FSplunkDeltaTracker MachineDeltas[(int32)ESplunkMachineKind::Num];
+
+    // Reused from one vehicle/train event to the next so their arrays keep their allocation
+    FSplunkVehicleReading VehicleReading;
+    FSplunkTrainReading TrainReading;
+
+    // Dimensioned metrics accumulators, keyed by name ID; reset every collection
+    TSplunkMetricGroups<FCircuitMetrics> CircuitMetrics;
+
+    // Circuit membership, rebuilt by the Circuits sweep when the registry reports a building change
+    FSplunkCircuitCache Circuits;
+    TArray<FSplunkCircuitReading> CircuitReadings;
+    FDelegateHandle GridChangeHandle;
+
+    // Power alerts are encoded on the game thread into their own writer and sent as one small request
+    FSplunkPowerAlerts PowerAlerts;
+    TArray<FSplunkPowerAlertEvent> PendingAlerts;
+    FSplunkHECWriter AlertWriter;
+    int64 PowerAlertsTotal = 0;
+    TSplunkMetricGroups<FSplunkMachineRollup> ClassMetrics;
+    TSplunkMetricGroups<FSplunkMachineRollup> ResourceMetrics;
+
+    // Events mode temporarily running metrics collectors because the buffer overflowed
+    bool bDegradedToMetrics = false;
+
+    int64 LastReportedDroppedEvents = 0;
     FDateTime LastBufferFlush;
 
     // ---------------------------------------------------------------
@@ -125,10 +348,19 @@ private:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection", meta = (AllowPrivateAccess = "true"))
     bool bUseMetricsMode = true;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection", meta = (AllowPrivateAccess = "true"))
+    bool bDimensionedMetrics = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection", meta = (AllowPrivateAccess = "true"))
+    int32 MaxSeriesPerDimension = 64;
+
     // Intervals (seconds) - apply to both metrics and events mode
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection Intervals", meta = (AllowPrivateAccess = "true"))
     float PowerInterval = 2.0f;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection Intervals", meta = (AllowPrivateAccess = "true"))
+    float PowerAlertInterval = 0.25f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection Intervals", meta = (AllowPrivateAccess = "true"))
     float ProductionInterval = 10.0f;
 
@@ -141,6 +373,9 @@ private:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection Intervals", meta = (AllowPrivateAccess = "true"))
     float BufferFlushInterval = 5.0f;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collection Intervals", meta = (AllowPrivateAccess = "true"))
+    float LayoutInterval = 3600.0f;
+
     // What to collect
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Data Types", meta = (AllowPrivateAccess = "true"))
     bool bCollectPowerData = true;
@@ -157,10 +392,127 @@ private:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Data Types", meta = (AllowPrivateAccess = "true"))
     bool bCollectLayoutData = false;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Data Types", meta = (AllowPrivateAccess = "true"))
+    int32 LayoutPageSize = 500;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Data Types", meta = (AllowPrivateAccess = "true"))
+    bool bLayoutChangeFeed = true;
+
+    FDelegateHandle LayoutChangeHandle;
+
+    // Per session, so a gap in what Splunk received shows up as a skipped number
+    int64 LayoutChangeSeq = 0;
+
+    // Set once a full snapshot has been submitted; later starts rely on the change feed and the interval
+    bool bLayoutBaselineSent = false;
+
     // Events mode only
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Events Mode", meta = (AllowPrivateAccess = "true"))
     int32 BatchSize = 10;
 
+    // Compression
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Compression", meta = (AllowPrivateAccess = "true"))
+    int32 GzipCompressionLevel = 6;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Compression", meta = (AllowPrivateAccess = "true"))
+    int32 GzipMinPayloadBytes = 1024;
+
+    // Send buffer
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Send Buffer", meta = (AllowPrivateAccess = "true"))
+    int32 MaxBufferMB = 32;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Send Buffer", meta = (AllowPrivateAccess = "true"))
+    int32 MaxConcurrentRequests = 4;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Send Buffer", meta = (AllowPrivateAccess = "true"))
+    ESplunkOverflowPolicy BufferOverflowPolicy = ESplunkOverflowPolicy::DropOldest;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Send Buffer", meta = (AllowPrivateAccess = "true"))
+    float PowerLaneFlushInterval = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Send Buffer", meta = (AllowPrivateAccess = "true"))
+    float BulkLaneFlushInterval = 30.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Send Buffer", meta = (AllowPrivateAccess = "true"))
+    bool bAdaptiveFlush = true;
+
+    // Sizes metrics/events batches from HEC's responses when bAdaptiveFlush is on
+    TUniquePtr<FSplunkFlushController> FlushController;
+
+    // Per-frame time budget for events-mode sweeps (0 = run each sweep to completion at once)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Events Mode", meta = (AllowPrivateAccess = "true"))
+    float CollectorFrameBudgetMs = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Events Mode", meta = (AllowPrivateAccess = "true"))
+    bool bDeltaMode = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Events Mode", meta = (AllowPrivateAccess = "true"))
+    float DeltaEpsilon = 0.01f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Events Mode", meta = (AllowPrivateAccess = "true"))
+    float DeltaKeyframeInterval = 300.0f;
+
+    // Disk spool
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Disk Spool", meta = (AllowPrivateAccess = "true"))
+    bool bEnableDiskSpool = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Disk Spool", meta = (AllowPrivateAccess = "true"))
+    int32 SpoolMaxDiskMB = 256;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Disk Spool", meta = (AllowPrivateAccess = "true"))
+    float SpoolRetryMinSeconds = 2.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Disk Spool", meta = (AllowPrivateAccess = "true"))
+    float SpoolRetryMaxSeconds = 300.0f;
+
+    TUniquePtr<FSplunkSpool> Spool;
+    FHttpRequestPtr SpoolReplayRequest;
+    double NextSpoolRetryTime = 0.0;
+    float SpoolBackoffSeconds = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Indexer Acknowledgement", meta = (AllowPrivateAccess = "true"))
+    bool bUseIndexerAck = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Indexer Acknowledgement", meta = (AllowPrivateAccess = "true"))
+    float AckPollInterval = 5.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Indexer Acknowledgement", meta = (AllowPrivateAccess = "true"))
+    float AckTimeoutSeconds = 120.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Indexer Acknowledgement", meta = (AllowPrivateAccess = "true"))
+    int32 AckMaxPendingMB = 64;
+
+    // Batches accepted by HEC but not yet committed; null unless bUseIndexerAck
+    TUniquePtr<FSplunkAckTracker> Acks;
+    FHttpRequestPtr AckPollRequest;
+    FTimerHandle AckPollTimer;
+    bool bWarnedAckDisabled = false;
+
+    // Evictions already logged, so each warning reports only the new ones
+    int64 LastLoggedAckEvictions = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Local Test Sink", meta = (AllowPrivateAccess = "true"))
+    bool bRunLocalSink = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Local Test Sink", meta = (AllowPrivateAccess = "true"))
+    int32 LocalSinkPort = 18088;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Local Test Sink", meta = (AllowPrivateAccess = "true"))
+    float LocalSinkLatencyMs = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Local Test Sink", meta = (AllowPrivateAccess = "true"))
+    float LocalSinkErrorRate = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Local Test Sink", meta = (AllowPrivateAccess = "true"))
+    float LocalSinkDropRate = 0.0f;
+
+    // In-process HEC stand-in; null unless bRunLocalSink
+    TSharedPtr<FSplunkLocalSink> LocalSink;
+
+    // True between a retryable failure and the next successful send; new batches go straight to disk
+    // Atomic because the pipeline worker reads it when dispatching.
+    std::atomic<bool> bSplunkUnavailable{ false };
+
     // Status
     UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
     bool bIsCollecting = false;
@@ -171,6 +523,33 @@ private:
     UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
     int32 EventsInBuffer = 0;
 
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int64 EventsDroppedTotal = 0;
+
     UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
     FDateTime LastSuccessfulSend;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int32 BatchesSpooledTotal = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int32 BatchesReplayedTotal = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int64 SpoolBytesOnDisk = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int32 HttpRequestsInFlight = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    float HttpLatencyMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int32 BatchesAwaitingAck = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int64 BatchesAckedTotal = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Status", meta = (AllowPrivateAccess = "true"))
+    int32 BatchesResentTotal = 0;
 };
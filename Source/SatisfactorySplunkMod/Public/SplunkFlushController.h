@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSplunkFlushControllerConfig
+{
+    // Batch size range, uncompressed bytes
+    int32 MinBatchBytes = 16 * 1024;
+    int32 MaxBatchBytes = 1024 * 1024;
+    int32 StartBatchBytes = 64 * 1024;
+
+    // Added per healthy response
+    int32 IncreaseStepBytes = 16 * 1024;
+
+    // Oldest event age that forces a send: BaseMaxAge while healthy, doubled per failure up to MaxMaxAge
+    float BaseMaxAge = 5.0f;
+    float MaxMaxAge = 60.0f;
+
+    // Round trip counts as climbing once the smoothed latency exceeds the baseline by this factor
+    float LatencyTolerance = 2.0f;
+};
+
+/**
+ * AIMD controller for how big HEC batches are and how long events may wait for one.
+ *
+ * Fed one observation per completed batch. While HEC is healthy the batch grows by a fixed
+ * step per response, trading a few more bytes per request for fewer requests. When the
+ * smoothed round trip climbs past LatencyTolerance times the baseline (the lowest recently
+ * seen, drifting up slowly so it can re-learn) the batch shrinks by a quarter; on an error
+ * it halves and the age limit doubles so the client backs off. Decreases are applied at most
+ * once per round trip, because the requests already in flight were sized before the last one.
+ *
+ * Game-thread only.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkFlushController
+{
+public:
+    explicit FSplunkFlushController(const FSplunkFlushControllerConfig& InConfig);
+
+    void OnSuccess(float LatencyMs);
+
+    /** Network error, 429 or 5xx. */
+    void OnFailure();
+
+    int32 GetBatchBytes() const { return BatchBytes; }
+    float GetMaxAge() const { return MaxAge; }
+
+    float GetSmoothedLatencyMs() const { return SmoothedLatencyMs; }
+    float GetBaselineLatencyMs() const { return BaselineLatencyMs; }
+
+    /** Moving share of batches that failed. */
+    float GetErrorRate() const { return ErrorRate; }
+
+    int64 GetIncreases() const { return Increases; }
+    int64 GetDecreases() const { return Decreases; }
+
+private:
+    /** Multiplies the batch size unless a decrease already happened within the last round trip. */
+    bool Decrease(float Factor);
+
+    const FSplunkFlushControllerConfig Config;
+
+    int32 BatchBytes;
+    float MaxAge;
+
+    float SmoothedLatencyMs = 0.0f;
+    float BaselineLatencyMs = 0.0f;
+    float ErrorRate = 0.0f;
+    double LastDecreaseTime = 0.0;
+
+    int64 Increases = 0;
+    int64 Decreases = 0;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Thin wrapper over the engine's bundled zlib for Content-Encoding: gzip payloads.
+ * Stateless and thread-safe; intended to run on a background thread.
+ */
+struct SATISFACTORYSPLUNKMOD_API FSplunkGzip
+{
+    /**
+     * Compresses Data into a complete gzip member.
+     * @param Level  zlib level, clamped to 1 (fastest) .. 9 (smallest)
+     * @return false if zlib failed; Out is left empty in that case
+     */
+    static bool Compress(const uint8* Data, int32 Len, int32 Level, TArray<uint8>& Out);
+
+    /**
+     * Inflates a gzip member (as produced by Compress) into Out.
+     * @return false if Data is not valid gzip; Out is left empty in that case
+     */
+    static bool Decompress(const uint8* Data, int32 Len, TArray<uint8>& Out);
+};
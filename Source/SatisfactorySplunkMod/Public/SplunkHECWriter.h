@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Pre-escaped JSON fragment stored as a compile-time UTF-8 literal.
+ * Build with SPLUNK_HEC_KEY / SPLUNK_HEC_STRING so nothing is escaped at runtime.
+ */
+struct FSplunkHECToken
+{
+    const ANSICHAR* Bytes;
+    int32 Len;
+};
+
+/** Object key including quotes and the trailing colon, e.g. "machine_id": */
+#define SPLUNK_HEC_KEY(Name)      FSplunkHECToken{ "\"" Name "\":", (int32)sizeof("\"" Name "\":") - 1 }
+
+/** Constant string value including quotes. Value must not need JSON escaping. */
+#define SPLUNK_HEC_STRING(Value)  FSplunkHECToken{ "\"" Value "\"", (int32)sizeof("\"" Value "\"") - 1 }
+
+/**
+ * Append-only encoder for Splunk HEC batches.
+ *
+ * Events are written as newline-delimited JSON straight into one UTF-8 byte buffer,
+ * which is Reset() between flushes so its allocation is reused. Nothing is ever built
+ * as an FJsonObject tree; nesting is tracked with a small inline stack.
+ *
+ * Usage:
+ *   Writer.BeginEvent(Time, SPLUNK_HEC_STRING("satisfactory:production"));
+ *   Writer.BeginObject(SPLUNK_HEC_KEY("event"));
+ *   Writer.WriteNumber(SPLUNK_HEC_KEY("efficiency"), Efficiency);
+ *   Writer.EndObject();
+ *   Writer.EndEvent();
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkHECWriter
+{
+public:
+    /** Opens an event with the standard time/host/sourcetype header. */
+    void BeginEvent(int64 UnixTime, FSplunkHECToken SourceType);
+
+    /** Opens a metrics event (event:"metric", source, sourcetype). Fields go in a "fields" object. */
+    void BeginMetricsEvent(int64 UnixTime);
+
+    /** Closes the top-level event object and terminates the line. */
+    void EndEvent();
+
+    void BeginObject(FSplunkHECToken Key);
+    void BeginObject();                         // array element
+    void EndObject();
+
+    void BeginArray(FSplunkHECToken Key);
+    void EndArray();
+
+    void WriteString(FSplunkHECToken Key, const FString& Value);
+    void WriteString(FSplunkHECToken Key, const TCHAR* Value);
+    void WriteString(FSplunkHECToken Key, FSplunkHECToken Value);
+
+    /** Writes a string value from bytes already escaped with Escape() (no quotes). */
+    void WriteEscapedString(FSplunkHECToken Key, const uint8* Escaped, int32 Len);
+
+    void WriteNumber(FSplunkHECToken Key, double Value);
+    void WriteInt(FSplunkHECToken Key, int64 Value);
+    void WriteBool(FSplunkHECToken Key, bool Value);
+
+    /** Encoded batch, one event per line. */
+    const TArray<uint8>& GetBuffer() const { return Buffer; }
+    int32 GetEventCount() const { return EventCount; }
+    int32 GetNumBytes() const { return Buffer.Num(); }
+    bool IsEmpty() const { return EventCount == 0; }
+
+    /** Drops all encoded events but keeps the allocation for the next batch. */
+    void Reset();
+
+    /** Moves the encoded bytes out (for one-shot writers) and resets the writer. */
+    TArray<uint8> ReleaseBuffer();
+
+    /** Appends Str as JSON-escaped UTF-8 (without quotes) to Out. */
+    static void Escape(const TCHAR* Str, int32 Len, TArray<uint8>& OutBuffer);
+
+private:
+    void WriteKey(FSplunkHECToken Key);
+    void WriteSeparator();
+    void PushScope(ANSICHAR Open);
+    void PopScope(ANSICHAR Close);
+
+    void AppendToken(FSplunkHECToken Token) { AppendBytes(Token.Bytes, Token.Len); }
+    void AppendChar(ANSICHAR Char) { Buffer.Add((uint8)Char); }
+    void AppendBytes(const ANSICHAR* Bytes, int32 Len);
+    void AppendEscaped(const TCHAR* Str, int32 Len) { Escape(Str, Len, Buffer); }
+    void AppendNumber(double Value);
+    void AppendInt(int64 Value);
+
+    TArray<uint8> Buffer;
+
+    // One entry per open object/array: true until the first member has been written
+    TArray<bool, TInlineAllocator<8>> FirstInScope;
+
+    int32 EventCount = 0;
+};
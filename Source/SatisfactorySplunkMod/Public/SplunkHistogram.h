@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * Fixed-size log-bucketed histogram for durations in microseconds.
+ *
+ * Each power of two is split into SubBuckets, so a percentile is accurate to about 19%
+ * from 1us up to ~67s, in a few hundred bytes and with no allocation. Intended to be
+ * Reset() after every report so percentiles describe the last reporting interval.
+ *
+ * Not thread-safe; each histogram belongs to one thread.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkHistogram
+{
+public:
+    static constexpr int32 SubBuckets = 4;
+    static constexpr int32 NumBuckets = 26 * SubBuckets;
+
+    void Record(double Microseconds);
+
+    /** Upper bound of the bucket holding the P-th percentile (0..1). 0 when empty. */
+    double GetPercentile(double P) const;
+
+    double GetMax() const { return Max; }
+    int64 GetCount() const { return Count; }
+
+    void Reset();
+
+private:
+    static int32 GetBucket(double Microseconds);
+    static double GetBucketUpperBound(int32 Bucket);
+
+    uint32 Buckets[NumBuckets] = {};
+    int64 Count = 0;
+    double Max = 0.0;
+};
+
+/** Records the lifetime of the scope into a histogram. */
+struct FSplunkScopedTiming
+{
+    explicit FSplunkScopedTiming(FSplunkHistogram& InHistogram)
+        : Histogram(InHistogram)
+        , StartTime(FPlatformTime::Seconds())
+    {
+    }
+
+    ~FSplunkScopedTiming()
+    {
+        Histogram.Record((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+    }
+
+    FSplunkHistogram& Histogram;
+    double StartTime;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "SplunkHistogram.h"
+#include <atomic>
+
+struct FSplunkHttpSenderConfig
+{
+    FString URL;
+    FString HECToken;
+
+    // X-Splunk-Request-Channel GUID, required by HEC indexer acknowledgement. Empty = not sent.
+    FString Channel;
+
+    // Requests allowed in flight before CanSend() says no and callers should coalesce
+    int32 MaxConcurrentRequests = 4;
+};
+
+/**
+ * Sends HEC payloads with a bounded number of requests in flight.
+ *
+ * Every request goes to the same host with identical headers and keep-alive, so the HTTP
+ * backend's connection cache (libcurl on all shipping platforms) reuses a handful of TLS
+ * connections instead of handshaking per flush. CanSend() is advisory: callers that must
+ * send regardless (final flush, spool replay) still may, and are counted like any other.
+ *
+ * Send() and the stats getters may be called from any thread. Completions and OnComplete
+ * run on the game thread, where the HTTP module delivers them.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkHttpSender : public TSharedFromThis<FSplunkHttpSender, ESPMode::ThreadSafe>
+{
+public:
+    using FCompleteFunc = TFunction<void(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)>;
+
+    FSplunkHttpSender(const FSplunkHttpSenderConfig& InConfig, FCompleteFunc InOnComplete);
+
+    /** True while fewer than MaxConcurrentRequests are in flight. */
+    bool CanSend() const { return InFlight.load(std::memory_order_relaxed) < Config.MaxConcurrentRequests; }
+
+    /** Starts a POST of Body to the HEC URL; the returned request identifies it in OnComplete. */
+    FHttpRequestPtr Send(TArray<uint8>&& Body, bool bGzipped) { return Post(Config.URL, MoveTemp(Body), bGzipped); }
+
+    /** Same, to another HEC endpoint (e.g. /services/collector/ack) with the same headers. */
+    FHttpRequestPtr Post(const FString& URL, TArray<uint8>&& Body, bool bGzipped);
+
+    int32 GetInFlight() const { return InFlight.load(std::memory_order_relaxed); }
+
+    /** Payload bytes of the requests currently in flight. */
+    int64 GetInFlightBytes() const { return InFlightBytes.load(std::memory_order_relaxed); }
+
+    // Round trip of completed requests, in milliseconds (game thread)
+    float GetLastLatencyMs() const { return LastLatencyMs; }
+    float GetAverageLatencyMs() const { return AverageLatencyMs; }
+
+    /** Round trips in microseconds since the owner last reset it (game thread). */
+    FSplunkHistogram& GetLatencyHistogram() { return LatencyHistogram; }
+
+private:
+    void OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, double StartTime, int64 Bytes);
+
+    const FSplunkHttpSenderConfig Config;
+    const FString AuthorizationHeader;
+    FCompleteFunc OnComplete;
+
+    std::atomic<int32> InFlight{ 0 };
+    std::atomic<int64> InFlightBytes{ 0 };
+
+    float LastLatencyMs = 0.0f;
+    float AverageLatencyMs = 0.0f;
+    FSplunkHistogram LatencyHistogram;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HttpRouteHandle.h"
+#include "HttpResultCallback.h"
+#include "Math/RandomStream.h"
+
+struct FHttpServerRequest;
+class IHttpRouter;
+
+struct FSplunkLocalSinkConfig
+{
+    int32 Port = 18088;
+
+    // Requests must carry "Authorization: Splunk <HECToken>"
+    FString HECToken;
+
+    // Fault injection; also changeable at runtime with splunk.sink.Faults
+    float LatencyMs = 0.0f;
+    float ErrorRate = 0.0f;     // share of batches answered 503 Server is busy
+    float DropRate = 0.0f;      // share of batches never answered
+};
+
+/**
+ * In-process HEC stand-in on http://127.0.0.1:<Port>, for measuring send throughput and
+ * exercising retry and backpressure without a Splunk instance.
+ * Start() adds a [HTTPServer.Listeners] ListenerOverrides entry for the port, so it listens
+ * on loopback whatever the engine's DefaultBindAddress is.
+ *
+ * Serves /services/collector, /services/collector/event and /services/collector/ack: checks
+ * the token, inflates gzip bodies, counts events (one per line, as FSplunkHECWriter emits them)
+ * and bytes, and hands out ack IDs when the request names a channel. Every batch is acked
+ * on the next poll.
+ *
+ * Faults are injected per batch: a delay before answering, a 503, or no answer at all so
+ * the client sees the connection die at its own timeout. Held requests are released on Stop().
+ *
+ * Game-thread only; the HTTP server dispatches its routes there.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkLocalSink : public TSharedFromThis<FSplunkLocalSink>
+{
+public:
+    struct FStats
+    {
+        int64 Requests = 0;
+        int64 Events = 0;
+        int64 WireBytes = 0;        // as received
+        int64 DecodedBytes = 0;     // after gzip
+        int64 Unauthorized = 0;
+        int64 Malformed = 0;
+        int64 InjectedErrors = 0;
+        int64 InjectedDrops = 0;
+        double StartTime = 0.0;
+    };
+
+    explicit FSplunkLocalSink(const FSplunkLocalSinkConfig& InConfig);
+    ~FSplunkLocalSink();
+
+    /** Binds the routes and starts listening. @return false if the port could not be bound */
+    bool Start();
+    void Stop();
+
+    /** The HEC event endpoint to point the exporter at. */
+    FString GetURL() const;
+
+    void SetFaults(float LatencyMs, float ErrorRate, float DropRate);
+
+    const FStats& GetStats() const { return Stats; }
+
+    /** Events accepted per second since Start(). */
+    double GetEventsPerSecond() const;
+
+    void LogStats() const;
+
+    /** The running sink, for the splunk.sink.* console commands. */
+    static TSharedPtr<FSplunkLocalSink> GetActive() { return Active.Pin(); }
+
+private:
+    struct FPendingResponse
+    {
+        double DueTime;
+        int32 Code;
+        FString Body;
+        FHttpResultCallback OnComplete;
+    };
+
+    bool HandleEvents(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    bool HandleAck(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+    /** Answers now or, with latency injected, once the ticker reaches the due time. */
+    void Respond(int32 Code, FString&& Body, const FHttpResultCallback& OnComplete);
+    bool Tick(float DeltaTime);
+
+    const FString* FindHeader(const FHttpServerRequest& Request, const TCHAR* Name) const;
+
+    FSplunkLocalSinkConfig Config;
+    const FString ExpectedAuthorization;
+
+    TSharedPtr<IHttpRouter> Router;
+    TArray<FHttpRouteHandle> Routes;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    TArray<FPendingResponse> Delayed;
+    TArray<FHttpResultCallback> Held;
+    FRandomStream Random;
+
+    int64 NextAckId = 0;
+    FStats Stats;
+    double NextStatsLogTime = 0.0;
+    int64 EventsAtLastLog = 0;
+
+    static TWeakPtr<FSplunkLocalSink> Active;
+};
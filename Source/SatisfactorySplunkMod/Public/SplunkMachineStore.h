@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SplunkMetricGroups.h"
+
+/** Which registry list a machine store mirrors. */
+enum class ESplunkMachineKind : uint8
+{
+    Manufacturer,
+    Extractor,
+    Generator,
+    Num
+};
+
+/** One machine's readings, as written to and read back from an FSplunkMachineStore row. */
+struct FSplunkMachineReading
+{
+    int32 NameId = INDEX_NONE;      // actor name; tells a reused slot's new machine from the old one
+    int32 GroupId = INDEX_NONE;     // class name, or resource item for extractors
+    uint64 Key = 0;                 // recipe or resource class; in delta mode any change is sent
+    float Power = 0.0f;             // consumption, or production for generators
+    float MaxPower = 0.0f;          // generators only
+    float Efficiency = 0.0f;
+    float Rate = 0.0f;              // extractors only
+    bool bProducing = false;        // generators only
+    float FuelEnergy = 0.0f;
+    int32 FuelStacks = INDEX_NONE;  // INDEX_NONE unless the machine burns fuel
+    FVector Location = FVector::ZeroVector;
+};
+
+/** Totals over the machines of one store or group, as read in the current pass. */
+struct SATISFACTORYSPLUNKMOD_API FSplunkMachineRollup
+{
+    static constexpr int32 NumEfficiencyBuckets = 10;
+
+    int32 Machines = 0;
+    int32 Producing = 0;            // efficiency > 0
+    float TotalEfficiency = 0.0f;   // over producing machines
+    float PowerConsumption = 0.0f;
+    float ExtractionRate = 0.0f;
+
+    // Producing machines by efficiency, 10% per bucket; overclocked machines land in the last
+    int32 EfficiencyBuckets[NumEfficiencyBuckets] = {};
+
+    /** Counts one machine. */
+    void Add(float Efficiency, float Power, float Rate);
+
+    /** Lowest efficiency at or below which Fraction of the producing machines lie, to bucket resolution. */
+    float GetEfficiencyPercentile(float Fraction) const;
+
+    FSplunkMachineRollup& operator+=(const FSplunkMachineRollup& Other);
+};
+
+/**
+ * Per-machine readings of one registry list in structure-of-arrays form.
+ *
+ * Each machine owns the row at its TSplunkActorList slot, and every field is a separate
+ * contiguous column. Slots are dense and reused after a dismantle, so the columns stay
+ * about as long as the list. Collectors write a row per machine per pass; Rollup() then
+ * sums a column at a time in loops without lookups or branches on the hot fields, and
+ * events-mode encoders and FSplunkDeltaTracker read the row back. Rows not written in
+ * the current pass (free slots) drop out of every rollup.
+ *
+ * Game-thread only.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkMachineStore
+{
+public:
+    /** Starts a new pass over a list with NumSlots slots; rows not written again are excluded from the rollups. */
+    void BeginPass(int32 NumSlots);
+
+    /** Writes the readings of the machine in Slot. */
+    void Write(int32 Slot, const FSplunkMachineReading& Reading);
+
+    /** Gathers one row back from the columns. */
+    FSplunkMachineReading Read(int32 Slot) const;
+
+    /** Totals over the rows written this pass. */
+    FSplunkMachineRollup Rollup() const;
+
+    /** Adds each row written this pass to Groups under its GroupId. */
+    void RollupGroups(TSplunkMetricGroups<FSplunkMachineRollup>& Groups) const;
+
+    int32 Num() const { return Stamps.Num(); }
+
+    void Reset();
+
+private:
+    void Grow(int32 NewNum);
+
+    // Columns, all Num() long
+    TArray<uint32> Stamps;              // pass the row was last written in; 0 = never
+    TArray<int32> Owners;
+    TArray<int32> GroupIds;
+    TArray<uint64> Keys;
+    TArray<float> Power;
+    TArray<float> MaxPower;
+    TArray<float> Efficiency;
+    TArray<float> Rate;
+    TArray<bool> Producing;
+    TArray<float> FuelEnergy;
+    TArray<int32> FuelStacks;
+    TArray<FVector> Locations;
+
+    uint32 Pass = 1;
+};
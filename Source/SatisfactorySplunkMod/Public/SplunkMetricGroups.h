@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Client-side pre-aggregation for dimensioned metrics: one accumulator per dimension
+ * value (a FSplunkStringTable ID such as a circuit, class or resource name).
+ *
+ * Cardinality is capped: once MaxGroups distinct values exist, further values all fold
+ * into a single OtherKey group, so a sprawling factory can't flood the metrics index
+ * with series. The map is Reset() per collection and keeps its allocation.
+ *
+ * Which values get their own group is decided once and kept across collections, so a
+ * value's series doesn't flip in and out of "_other" as the actor lists are reordered.
+ * A value gives its group up only after a whole collection without it.
+ */
+template<typename AccumulatorType>
+class TSplunkMetricGroups
+{
+public:
+    static constexpr int32 OtherKey = INDEX_NONE;
+
+    void Reset(int32 InMaxGroups)
+    {
+        for (auto It = Admitted.CreateIterator(); It; ++It)
+        {
+            if (!Groups.Contains(*It))
+            {
+                It.RemoveCurrent();
+            }
+        }
+        Groups.Reset();
+        MaxGroups = FMath::Max(InMaxGroups, 1);
+    }
+
+    AccumulatorType& FindOrAdd(int32 Key)
+    {
+        if (AccumulatorType* Existing = Groups.Find(Key))
+        {
+            return *Existing;
+        }
+        if (Admitted.Contains(Key))
+        {
+            return Groups.Add(Key);
+        }
+        if (Admitted.Num() < MaxGroups)
+        {
+            Admitted.Add(Key);
+            return Groups.Add(Key);
+        }
+        return Groups.FindOrAdd(OtherKey);
+    }
+
+    /** Calls Func(int32 Key, const AccumulatorType&) for every group. */
+    template<typename FuncType>
+    void ForEach(FuncType&& Func) const
+    {
+        for (const TPair<int32, AccumulatorType>& Group : Groups)
+        {
+            Func(Group.Key, Group.Value);
+        }
+    }
+
+private:
+    TMap<int32, AccumulatorType> Groups;
+
+    // Values with a group of their own, carried over from earlier collections
+    TSet<int32> Admitted;
+    int32 MaxGroups = 64;
+};
@@ -4,6 +4,18 @@
 #include "UObject/Object.h"
 #include "SplunkModSettings.generated.h"
 
+/** What to give up when the in-memory send buffer is full. */
+UENUM()
+enum class ESplunkOverflowPolicy : uint8
+{
+    /** Evict the oldest buffered events to make room for new ones. */
+    DropOldest,
+    /** Keep what is buffered and discard new events. */
+    DropNewest,
+    /** Drop new events and switch events mode down to metrics mode until the buffer drains. */
+    DegradeToMetrics
+};
+
 /**
  * Singleton config object for the Satisfactory Splunk Exporter mod.
  * Values are read from Config/DefaultSatisfactorySplunkMod.ini at startup.
@@ -37,6 +49,17 @@ public:
     UPROPERTY(Config, EditAnywhere, Category = "Collection")
     bool bUseMetricsMode = true;
 
+    /**
+     * Metrics mode: besides the global totals, send power per circuit, efficiency per
+     * manufacturer class and extraction per resource type as dimensioned metrics.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Collection")
+    bool bDimensionedMetrics = true;
+
+    /** Most distinct circuits/classes/resources sent per collection; the rest are summed as "_other". */
+    UPROPERTY(Config, EditAnywhere, Category = "Collection")
+    int32 MaxSeriesPerDimension = 64;
+
     // ---------------------------------------------------------------
     // Collection Intervals (apply to BOTH metrics and events mode)
     //
@@ -48,6 +71,13 @@ public:
     UPROPERTY(Config, EditAnywhere, Category = "Collection Intervals")
     float PowerInterval = 2.0f;
 
+    /**
+     * Seconds between checks of every circuit's fuse and batteries. A change is sent to
+     * Splunk at once in its own request, ahead of the send buffer. O(circuits). 0 = off.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Collection Intervals")
+    float PowerAlertInterval = 0.25f;
+
     /** Seconds between production machine data collections. Efficiency changes slowly. */
     UPROPERTY(Config, EditAnywhere, Category = "Collection Intervals")
     float ProductionInterval = 10.0f;
@@ -60,10 +90,18 @@ public:
     UPROPERTY(Config, EditAnywhere, Category = "Collection Intervals")
     float PlayerInterval = 30.0f;
 
-    /** Seconds between buffer flushes to Splunk. Should be <= PowerInterval. */
+    /** Seconds between buffer flushes to Splunk of the metrics and events lanes. Power data has its own lane. */
     UPROPERTY(Config, EditAnywhere, Category = "Collection Intervals")
     float BufferFlushInterval = 5.0f;
 
+    /**
+     * Seconds between full factory layout snapshots (events mode, bCollectLayoutData).
+     * With bLayoutChangeFeed these are only baselines for the change events to be replayed onto.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Collection Intervals")
+    float LayoutInterval = 3600.0f;
+
+
     // ---------------------------------------------------------------
     // What to collect
     // ---------------------------------------------------------------
@@ -80,18 +118,175 @@ public:
     UPROPERTY(Config, EditAnywhere, Category = "Data Types")
     bool bCollectPlayerData = true;
 
-    /** WARNING: Snapshots all buildings - produces very large payloads. Events mode only. */
+    /**
+     * Periodic snapshot of every building's position, sent as pages of LayoutPageSize
+     * buildings over several frames. High volume on large factories. Events mode only.
+     */
     UPROPERTY(Config, EditAnywhere, Category = "Data Types")
     bool bCollectLayoutData = false;
 
+    /** Buildings per layout page event (50-2000). */
+    UPROPERTY(Config, EditAnywhere, Category = "Data Types")
+    int32 LayoutPageSize = 500;
+
+    /**
+     * Send one small event per building constructed or dismantled, plus a baseline snapshot
+     * when collection starts, so layout costs O(changes) between snapshots.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Data Types")
+    bool bLayoutChangeFeed = true;
+
     // ---------------------------------------------------------------
     // Events Mode Only
     // ---------------------------------------------------------------
 
-    /** Buffer this many events before forcing an early flush (events mode only). */
+    /** Buffer this many events before forcing an early flush (events mode only, without bAdaptiveFlush). */
     UPROPERTY(Config, EditAnywhere, Category = "Events Mode")
     int32 BatchSize = 10;
 
+    /**
+     * Events mode spreads each per-machine sweep over several frames, spending at most
+     * this many milliseconds of game-thread time per frame. 0 runs each sweep in one go.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Events Mode")
+    float CollectorFrameBudgetMs = 0.5f;
+
+    /**
+     * Only send a machine's production/extraction/generator event when one of its readings
+     * changed by more than DeltaEpsilon, or its recipe/resource changed. Every
+     * DeltaKeyframeInterval seconds all machines are sent (marked "keyframe":true).
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Events Mode")
+    bool bDeltaMode = false;
+
+    /** Relative change that counts as "changed" (0.01 = 1%; absolute below 1.0). */
+    UPROPERTY(Config, EditAnywhere, Category = "Events Mode")
+    float DeltaEpsilon = 0.01f;
+
+    /** Seconds between full keyframes in delta mode. */
+    UPROPERTY(Config, EditAnywhere, Category = "Events Mode")
+    float DeltaKeyframeInterval = 300.0f;
+
+    // ---------------------------------------------------------------
+    // Send Buffer
+    // ---------------------------------------------------------------
+
+    /** Memory budget for events waiting to be sent. Allocated once at startup. */
+    UPROPERTY(Config, EditAnywhere, Category = "Send Buffer")
+    int32 MaxBufferMB = 32;
+
+    /**
+     * HEC requests allowed in flight at once. While they are all busy, new events wait
+     * in the buffer and go out together in one larger batch when a request completes.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Send Buffer")
+    int32 MaxConcurrentRequests = 4;
+
+    /** What to do when the buffer is full because Splunk is not keeping up. */
+    UPROPERTY(Config, EditAnywhere, Category = "Send Buffer")
+    ESplunkOverflowPolicy BufferOverflowPolicy = ESplunkOverflowPolicy::DropOldest;
+
+    /**
+     * Seconds between sends of the power lane, which holds power metrics and circuit events.
+     * It flushes on its own rather than with BufferFlushInterval and has first claim on free requests.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Send Buffer")
+    float PowerLaneFlushInterval = 1.0f;
+
+    /** Seconds between sends of the bulk lane (layout snapshots and changes), so they go out in large batches. */
+    UPROPERTY(Config, EditAnywhere, Category = "Send Buffer")
+    float BulkLaneFlushInterval = 30.0f;
+
+    /**
+     * Size metrics and events batches from HEC's round trip time and error rate instead of
+     * BufferFlushInterval and BatchSize: batches grow while HEC is healthy and shrink and back
+     * off when latency climbs or requests fail. Events wait at most BufferFlushInterval while healthy.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Send Buffer")
+    bool bAdaptiveFlush = true;
+
+    // ---------------------------------------------------------------
+    // Compression
+    // ---------------------------------------------------------------
+
+    /** gzip level for HEC payloads: 1 = fastest .. 9 = smallest. 0 disables compression. */
+    UPROPERTY(Config, EditAnywhere, Category = "Compression")
+    int32 GzipCompressionLevel = 6;
+
+    /** Payloads smaller than this many bytes are sent uncompressed. */
+    UPROPERTY(Config, EditAnywhere, Category = "Compression")
+    int32 GzipMinPayloadBytes = 1024;
+
+    // ---------------------------------------------------------------
+    // Disk Spool (retry of failed sends)
+    // ---------------------------------------------------------------
+
+    /** Write batches that fail with a network error or 5xx/429 to disk and replay them later. */
+    UPROPERTY(Config, EditAnywhere, Category = "Disk Spool")
+    bool bEnableDiskSpool = true;
+
+    /** Maximum disk space for spooled batches. Oldest data is evicted first. */
+    UPROPERTY(Config, EditAnywhere, Category = "Disk Spool")
+    int32 SpoolMaxDiskMB = 256;
+
+    /** First retry delay after Splunk becomes unreachable. Doubles on every failed retry. */
+    UPROPERTY(Config, EditAnywhere, Category = "Disk Spool")
+    float SpoolRetryMinSeconds = 2.0f;
+
+    /** Upper bound for the retry delay. */
+    UPROPERTY(Config, EditAnywhere, Category = "Disk Spool")
+    float SpoolRetryMaxSeconds = 300.0f;
+
+    // ---------------------------------------------------------------
+    // Indexer Acknowledgement (at-least-once delivery)
+    // ---------------------------------------------------------------
+
+    /**
+     * Keep every batch until Splunk confirms the indexers committed it, and resend it if
+     * that doesn't happen. Requires "Enable indexer acknowledgement" on the HEC token.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Indexer Acknowledgement")
+    bool bUseIndexerAck = false;
+
+    /** Seconds between polls of /services/collector/ack. One poll covers all pending batches. */
+    UPROPERTY(Config, EditAnywhere, Category = "Indexer Acknowledgement")
+    float AckPollInterval = 5.0f;
+
+    /** Batches not acknowledged within this many seconds are sent again. */
+    UPROPERTY(Config, EditAnywhere, Category = "Indexer Acknowledgement")
+    float AckTimeoutSeconds = 120.0f;
+
+    /** Memory for batches awaiting acknowledgement. When full the oldest stop being tracked and are not resent. */
+    UPROPERTY(Config, EditAnywhere, Category = "Indexer Acknowledgement")
+    int32 AckMaxPendingMB = 64;
+
+    // ---------------------------------------------------------------
+    // Local Test Sink
+    // ---------------------------------------------------------------
+
+    /**
+     * Run an in-process HEC stand-in on 127.0.0.1 and send to it instead of SplunkURL.
+     * For throughput and retry testing without Splunk; nothing is stored.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Local Test Sink")
+    bool bRunLocalSink = false;
+
+    /** Not 8088, which a local Splunk already uses. If the port is taken, collection does not start. */
+    UPROPERTY(Config, EditAnywhere, Category = "Local Test Sink")
+    int32 LocalSinkPort = 18088;
+
+    /** Delay before the sink answers each request (ms). */
+    UPROPERTY(Config, EditAnywhere, Category = "Local Test Sink")
+    float LocalSinkLatencyMs = 0.0f;
+
+    /** Share of batches (0-1) answered with 503 Server is busy. */
+    UPROPERTY(Config, EditAnywhere, Category = "Local Test Sink")
+    float LocalSinkErrorRate = 0.0f;
+
+    /** Share of batches (0-1) never answered, as if the connection dropped. */
+    UPROPERTY(Config, EditAnywhere, Category = "Local Test Sink")
+    float LocalSinkDropRate = 0.0f;
+
     // ---------------------------------------------------------------
     // Helpers
     // ---------------------------------------------------------------
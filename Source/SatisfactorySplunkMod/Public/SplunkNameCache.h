@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "FGRecipe.h"
+#include "FGItemDescriptor.h"
+#include "SplunkSample.h"
+
+/** Display names of one recipe, resolved once per recipe class. */
+struct FSplunkRecipeNames
+{
+    struct FItem
+    {
+        int32 NameId;
+        int32 Amount;
+    };
+
+    int32 RecipeNameId = INDEX_NONE;
+    TArray<FItem, TInlineAllocator<2>> Products;
+    TArray<FItem, TInlineAllocator<4>> Ingredients;
+};
+
+/**
+ * Game-thread cache of the names collectors write on every sample, stored as
+ * FSplunkStringTable IDs so each name is fetched, localized and escaped once.
+ *
+ *  - Actor names are keyed by FName, so a hit never builds an FString.
+ *  - Class names and item/recipe display names are keyed by UClass*.
+ *  - Power circuit IDs are keyed by the ID itself.
+ *  - Each machine remembers its recipe; the cached names are re-resolved only
+ *    when GetCurrentRecipe() returns something different.
+ *
+ * Display names are dropped when the game language changes.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkNameCache
+{
+public:
+    explicit FSplunkNameCache(FSplunkStringTable& InStrings);
+    ~FSplunkNameCache();
+
+    int32 GetActorName(const AActor* Actor);
+    int32 GetClassName(const UClass* Class);
+    int32 GetItemName(const UClass* ItemClass);
+
+    /** Power circuit ID as a string, for use as a metrics dimension. */
+    int32 GetCircuitName(int32 CircuitId);
+
+    /** Names for Machine's current recipe, or nullptr if it has none. */
+    const FSplunkRecipeNames* GetRecipeNames(const AActor* Machine, TSubclassOf<UFGRecipe> Recipe);
+
+private:
+    struct FMachineRecipe
+    {
+        TSubclassOf<UFGRecipe> Recipe;
+        int32 RecipeIndex = INDEX_NONE;
+    };
+
+    int32 GetRecipeIndex(const UClass* RecipeClass);
+    void OnCultureChanged();
+
+    FSplunkStringTable& Strings;
+
+    TMap<FName, int32> ActorNames;
+    TMap<TObjectKey<UClass>, int32> ClassNames;
+    TMap<TObjectKey<UClass>, int32> ItemNames;
+    TMap<int32, int32> CircuitNames;
+
+    // Recipe names are stored by index so machines can hold on to them across rehashes
+    TMap<TObjectKey<UClass>, int32> RecipeIndices;
+    TArray<FSplunkRecipeNames> Recipes;
+    TMap<FName, FMachineRecipe> MachineRecipes;
+
+    FDelegateHandle CultureChangedHandle;
+};
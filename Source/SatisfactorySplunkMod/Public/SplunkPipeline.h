@@ -0,0 +1,218 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "HAL/Runnable.h"
+#include "SplunkSample.h"
+#include "SplunkHECWriter.h"
+#include "SplunkEventRing.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+/** Send lanes, highest priority first. Each has its own buffer, batch size and flush cadence. */
+enum class ESplunkLane : uint8
+{
+    Power,      // power metrics and circuit events: small and latency-critical
+    Metrics,    // other aggregates and the exporter's self-metrics
+    Events,     // detailed per-machine, vehicle and player events
+    Bulk,       // factory layout snapshots and change feed
+    Num
+};
+
+struct FSplunkLaneConfig
+{
+    // Share of BufferCapacityBytes this lane may hold
+    float CapacityShare = 0.25f;
+
+    // Uncompressed bytes per HEC request from this lane
+    int32 MaxPayloadBytes = 1024 * 1024;
+
+    // Seconds between flushes the worker starts on its own; 0 = only on RequestFlush().
+    // Either way a lane holding a full payload sends it without waiting.
+    float FlushInterval = 0.0f;
+
+    // Relative share of send slots while several lanes are waiting for one
+    int32 Weight = 1;
+
+    // Batch size and age limit come from SetAdaptiveFlush() instead of MaxPayloadBytes and
+    // RequestFlush(); MaxPayloadBytes still caps the batch
+    bool bAdaptive = false;
+};
+
+struct FSplunkPipelineConfig
+{
+    int32 BufferCapacityBytes = 32 * 1024 * 1024;
+    bool bEvictOldest = true;
+
+    FSplunkLaneConfig Lanes[(int32)ESplunkLane::Num] =
+    {
+        //  share  payload       interval  weight
+        {   0.05f,   64 * 1024,  1.0f,     8 },    // Power
+        {   0.15f,  256 * 1024,  0.0f,     4 },    // Metrics
+        {   0.50f, 1024 * 1024,  0.0f,     2 },    // Events
+        {   0.30f, 1024 * 1024, 30.0f,     1 },    // Bulk
+    };
+
+    int32 GzipCompressionLevel = 6;
+    int32 GzipMinPayloadBytes = 1024;
+
+    FSplunkLaneConfig& GetLane(ESplunkLane Lane) { return Lanes[(int32)Lane]; }
+};
+
+/**
+ * Two-stage send pipeline.
+ *
+ * The game thread records events as FSplunkSample PODs and Submit()s them to a bounded
+ * lock-free SPSC queue. A worker thread drains the queue, encodes HEC JSON, buffers the
+ * encoded events in one FSplunkEventRing per lane and, when a lane is due, batches,
+ * gzip-compresses and hands each payload to the dispatch callback (on the worker).
+ * While the CanDispatch callback says no, events stay in the rings and go out together
+ * in fewer, larger payloads once it says yes again.
+ *
+ * Lanes keep a layout snapshot or a cargo backlog from delaying power data: each lane
+ * overflows on its own, and when several lanes are due the send slots are shared by
+ * smooth weighted round robin, so a waiting power batch goes out next rather than after
+ * every bulk payload queued before it.
+ *
+ * Submit/RequestFlush/Shutdown are game-thread only. Stats getters may be called from any thread.
+ * Without multithreading support the same work runs inline on the game thread, and lane
+ * flush intervals are only checked when RequestFlush() is called.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkPipeline : public FRunnable
+{
+public:
+    // Published by the worker after each drain/flush
+    struct FLaneStats
+    {
+        std::atomic<int32> BufferedEvents{ 0 };
+        std::atomic<int32> BufferedBytes{ 0 };
+        std::atomic<int64> DroppedEvents{ 0 };
+        std::atomic<int64> Batches{ 0 };
+    };
+
+    using FDispatchFunc = TFunction<void(TArray<uint8>&& Body, bool bGzipped)>;
+    using FCanDispatchFunc = TFunction<bool()>;
+
+    FSplunkPipeline(const FSplunkPipelineConfig& InConfig, FDispatchFunc InDispatch, FCanDispatchFunc InCanDispatch);
+    virtual ~FSplunkPipeline() override;
+
+    void Start();
+
+    /** Drains and flushes everything still queued, then joins the worker. */
+    void Shutdown();
+
+    /**
+     * Queues one complete event (the samples up to and including its EndEvent).
+     * @param Lane          send lane to buffer it in
+     * @param bEvictOldest  make room in a full lane instead of dropping this event
+     * @return false if the queue stayed full and the event was dropped. A full queue first
+     *         waits (briefly) for the worker, so this only happens if the worker is stuck.
+     */
+    bool Submit(TArrayView<const FSplunkSample> Samples, ESplunkLane Lane, bool bEvictOldest);
+
+    /** Asks the worker to send what is buffered in every lane without a FlushInterval of its own. */
+    void RequestFlush();
+
+    /** Asks the worker to send what is already due, e.g. because a request slot just freed up. */
+    void RequestDispatch();
+
+    /**
+     * Flush targets for adaptive lanes: send once a lane holds BatchBytes, or its oldest event
+     * has waited MaxAgeSeconds. Any thread.
+     */
+    void SetAdaptiveFlush(int32 BatchBytes, float MaxAgeSeconds);
+
+    FSplunkStringTable& GetStringTable() { return Strings; }
+
+    // Totals over all lanes
+    int32 GetBufferedEvents() const { return BufferedEvents.load(std::memory_order_relaxed); }
+    int32 GetBufferedBytes() const { return BufferedBytes.load(std::memory_order_relaxed); }
+    float GetFillRatio() const { return Config.BufferCapacityBytes > 0 ? (float)GetBufferedBytes() / Config.BufferCapacityBytes : 0.0f; }
+    int64 GetDroppedEvents() const { return RingDroppedEvents.load(std::memory_order_relaxed) + QueueDroppedEvents.load(std::memory_order_relaxed); }
+    int64 GetDroppedBytes() const { return RingDroppedBytes.load(std::memory_order_relaxed); }
+
+    /** Submits that found the queue full and had to wait for the worker. */
+    int64 GetQueueWaits() const { return QueueWaits.load(std::memory_order_relaxed); }
+
+    // Per lane
+    const FLaneStats& GetLaneStats(ESplunkLane Lane) const { return LaneStats[(int32)Lane]; }
+    float GetLaneFillRatio(ESplunkLane Lane) const;
+    static const TCHAR* GetLaneName(ESplunkLane Lane);
+
+    // Cumulative worker-side cost
+    int64 GetEncodedEvents() const { return EncodedEvents.load(std::memory_order_relaxed); }
+    int64 GetPayloadBytes() const { return PayloadBytes.load(std::memory_order_relaxed); }     // before gzip
+    int64 GetDispatchedBytes() const { return DispatchedBytes.load(std::memory_order_relaxed); } // on the wire
+    int64 GetEncodeMicros() const { return EncodeMicros.load(std::memory_order_relaxed); }
+    int64 GetCompressMicros() const { return CompressMicros.load(std::memory_order_relaxed); }
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    static constexpr uint32 QueueSize = 1 << 16;
+    static constexpr uint32 WakeThreshold = QueueSize / 2;
+
+    struct FLane
+    {
+        FSplunkLaneConfig Config;
+        FSplunkEventRing Ring;
+        double NextFlushTime = 0.0;
+        double OldestTime = 0.0;        // when the ring last went from empty to non-empty
+        bool bFlushPending = false;     // set when due, cleared once the ring is empty
+        int32 CurrentWeight = 0;        // smooth weighted round robin state
+    };
+
+    void Drain();
+
+    /** Marks lanes due: on request, on their own interval, or because a full payload is waiting. */
+    void ScheduleFlushes(bool bRequested);
+
+    /** Sends from due lanes (every non-empty lane if bFinal) while the sender has room. */
+    void Flush(bool bFinal);
+
+    /** The next lane to get a send slot, or INDEX_NONE if nothing is due. */
+    int32 PickLane(bool bFinal);
+    void SendBatch(FLane& Lane, int32 LaneIndex);
+
+    void Decode(const FSplunkSample& Sample);
+    void PublishStats();
+
+    FSplunkPipelineConfig Config;
+    FDispatchFunc Dispatch;
+    FCanDispatchFunc CanDispatch;
+
+    TCircularQueue<FSplunkSample> Queue;
+    FSplunkStringTable Strings;
+
+    // Worker-owned
+    FSplunkHECWriter Writer;
+    FLane Lanes[(int32)ESplunkLane::Num];
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    std::atomic<bool> bStopping{ false };
+    std::atomic<bool> bFlushRequested{ false };
+    std::atomic<int32> AdaptiveBatchBytes{ 0 };
+    std::atomic<float> AdaptiveMaxAge{ 0.0f };
+
+    // Published by the worker after each drain/flush
+    std::atomic<int32> BufferedEvents{ 0 };
+    std::atomic<int32> BufferedBytes{ 0 };
+    std::atomic<int64> RingDroppedEvents{ 0 };
+    std::atomic<int64> RingDroppedBytes{ 0 };
+    FLaneStats LaneStats[(int32)ESplunkLane::Num];
+
+    // Counted by the producer when the queue itself is full
+    std::atomic<int64> QueueDroppedEvents{ 0 };
+    std::atomic<int64> QueueWaits{ 0 };
+
+    std::atomic<int64> EncodedEvents{ 0 };
+    std::atomic<int64> PayloadBytes{ 0 };
+    std::atomic<int64> DispatchedBytes{ 0 };
+    std::atomic<int64> EncodeMicros{ 0 };
+    std::atomic<int64> CompressMicros{ 0 };
+};
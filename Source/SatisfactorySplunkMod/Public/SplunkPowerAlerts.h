@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SplunkCircuitCache.h"
+
+enum class ESplunkPowerAlert : uint8
+{
+    FuseTriggered,
+    FuseReset,
+    BatteryDraining,    // batteries started covering a shortfall
+    BatteryStable,      // ...and stopped
+    BatteryEmpty,       // nothing left to cover it; the fuse is next
+};
+
+struct FSplunkPowerAlertEvent
+{
+    ESplunkPowerAlert Alert;
+    FSplunkCircuitReading Reading;
+};
+
+/**
+ * Edge detector over circuit readings: reports fuse and battery state changes, not levels.
+ *
+ * Each circuit's first reading only sets its baseline, so starting collection on a grid
+ * that is already down does not raise alerts. A circuit that disappears (grids merged or
+ * split) is forgotten; the circuit it became starts a new baseline.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkPowerAlerts
+{
+public:
+    // Battery flow counts as draining below this, so rounding noise around 0 doesn't flap
+    static constexpr float DrainThresholdMW = 0.1f;
+
+    // Stored energy at or below this counts as empty
+    static constexpr float EmptyThresholdMWh = 0.01f;
+
+    /** Compares Readings against the previous call and appends one entry to Out per edge. */
+    void Detect(TConstArrayView<FSplunkCircuitReading> Readings, TArray<FSplunkPowerAlertEvent>& Out);
+
+    void Reset() { States.Reset(); }
+
+    static const TCHAR* ToString(ESplunkPowerAlert Alert);
+
+private:
+    struct FState
+    {
+        bool bFuseTriggered = false;
+        bool bDraining = false;
+        bool bEmpty = false;
+        uint32 Generation = 0;
+    };
+
+    TMap<int32, FState> States;
+    uint32 Generation = 0;
+};
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+#include "SplunkHECWriter.h"
+
+/** One step of an encoded event, replayed into an FSplunkHECWriter on the pipeline worker. */
+enum class ESplunkSampleOp : uint8
+{
+    BeginEvent,         // Key = sourcetype, Int = unix time
+    BeginMetricsEvent,  // Int = unix time
+    EndEvent,           // Int bit 0: evict older events if the send buffer is full; bits 1+: ESplunkLane
+    BeginObject,        // Key.Bytes == nullptr for array elements
+    EndObject,
+    BeginArray,
+    EndArray,
+    String,             // StringId into FSplunkStringTable
+    Token,              // constant pre-escaped value (SPLUNK_HEC_STRING)
+    Number,
+    Int,
+    Bool
+};
+
+/**
+ * Plain-old-data sample: an op, a static key literal and a raw value.
+ * Recording one is a handful of stores; no formatting or escaping happens on the game thread.
+ */
+struct FSplunkSample
+{
+    ESplunkSampleOp Op;
+    int32 TokenLen;             // length of Token for ESplunkSampleOp::Token
+    FSplunkHECToken Key;
+    union
+    {
+        double Number;
+        int64 Int;
+        int32 StringId;
+        const ANSICHAR* Token;
+        bool bValue;
+    };
+};
+
+/**
+ * Session-lifetime intern table for the dynamic strings collectors write (actor names,
+ * display names). Each string is escaped to JSON UTF-8 once, when first interned; samples
+ * carry the ID and the encoder copies the bytes.
+ *
+ * Intern() and Add() are game-thread only. Write() may be called from any thread.
+ * Entries are never removed: the set of names in one world is bounded by what was built.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkStringTable
+{
+public:
+    /** Returns the ID of Value, adding it if this exact string hasn't been seen. */
+    int32 Intern(const FString& Value);
+
+    /** Adds Value without deduplicating; for callers that cache the ID under their own key. */
+    int32 Add(const FString& Value);
+
+    /** Writes entry Id as a string value. */
+    void Write(FSplunkHECWriter& Writer, FSplunkHECToken Key, int32 Id) const;
+
+    int32 Num() const { return Spans.Num(); }
+
+private:
+    // FString map keys compare case-insensitively by default; names must stay distinct
+    struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+    {
+        static const FString& GetSetKey(const TPair<FString, int32>& Element) { return Element.Key; }
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    // Game thread only
+    TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> Ids;
+
+    struct FSpan
+    {
+        int32 Offset;
+        int32 Len;
+    };
+
+    // Appended by the game thread, read by the worker
+    TArray<uint8> Bytes;
+    TArray<FSpan> Spans;
+    mutable FCriticalSection Lock;
+};
+
+/**
+ * Game-thread recorder with the same interface as FSplunkHECWriter.
+ * Collectors write one event, then hand GetSamples() to FSplunkPipeline::Submit.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkSampleWriter
+{
+public:
+    void SetStringTable(FSplunkStringTable* InStrings) { Strings = InStrings; }
+
+    void BeginEvent(int64 UnixTime, FSplunkHECToken SourceType);
+    void BeginMetricsEvent(int64 UnixTime);
+    void EndEvent();
+
+    void BeginObject(FSplunkHECToken Key)   { Add(ESplunkSampleOp::BeginObject, Key); }
+    void BeginObject()                      { Add(ESplunkSampleOp::BeginObject, FSplunkHECToken{ nullptr, 0 }); }
+    void EndObject()                        { Add(ESplunkSampleOp::EndObject, FSplunkHECToken{ nullptr, 0 }); }
+
+    void BeginArray(FSplunkHECToken Key)    { Add(ESplunkSampleOp::BeginArray, Key); }
+    void EndArray()                         { Add(ESplunkSampleOp::EndArray, FSplunkHECToken{ nullptr, 0 }); }
+
+    void WriteString(FSplunkHECToken Key, const FString& Value);
+    void WriteString(FSplunkHECToken Key, const TCHAR* Value) { WriteString(Key, FString(Value)); }
+    void WriteString(FSplunkHECToken Key, FSplunkHECToken Value);
+
+    /** Writes a string by FSplunkStringTable ID, e.g. one returned by FSplunkNameCache. */
+    void WriteName(FSplunkHECToken Key, int32 StringId) { Add(ESplunkSampleOp::String, Key).StringId = StringId; }
+
+    void WriteNumber(FSplunkHECToken Key, double Value) { Add(ESplunkSampleOp::Number, Key).Number = Value; }
+    void WriteInt(FSplunkHECToken Key, int64 Value)     { Add(ESplunkSampleOp::Int, Key).Int = Value; }
+    void WriteBool(FSplunkHECToken Key, bool Value)     { Add(ESplunkSampleOp::Bool, Key).bValue = Value; }
+
+    TArrayView<const FSplunkSample> GetSamples() const { return Samples; }
+
+    /** Drops recorded samples but keeps the allocation. */
+    void Reset() { Samples.Reset(); }
+
+private:
+    FSplunkSample& Add(ESplunkSampleOp Op, FSplunkHECToken Key)
+    {
+        FSplunkSample& Sample = Samples.AddUninitialized_GetRef();
+        Sample.Op = Op;
+        Sample.TokenLen = 0;
+        Sample.Key = Key;
+        Sample.Int = 0;
+        return Sample;
+    }
+
+    FSplunkStringTable* Strings = nullptr;
+    TArray<FSplunkSample> Samples;
+};
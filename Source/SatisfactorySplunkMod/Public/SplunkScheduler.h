@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SplunkScheduler.generated.h"
+
+/** One periodic exporter task and where it sits in the collection cycle. */
+USTRUCT(BlueprintType)
+struct SATISFACTORYSPLUNKMOD_API FSplunkScheduleEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Splunk Exporter")
+    FString Name;
+
+    /** Seconds between runs. */
+    UPROPERTY(BlueprintReadOnly, Category = "Splunk Exporter")
+    float Interval = 0.0f;
+
+    /** Offset in seconds added to the first run, so the task lands in its own slot. */
+    UPROPERTY(BlueprintReadOnly, Category = "Splunk Exporter")
+    float Phase = 0.0f;
+
+    /** Heavy tasks never share a frame with each other; later ones slip to the next frame. */
+    UPROPERTY(BlueprintReadOnly, Category = "Splunk Exporter")
+    bool bHeavy = false;
+};
+
+/**
+ * Spreads periodic tasks across their common period so their timers never expire together.
+ *
+ * Heavy and light tasks are spread separately, so a fast light task (the 0.25 s power alert
+ * check) doesn't shrink the period the heavy collectors are spread over. Within each kind,
+ * intervals are quantized to Quantum and the base period P is their greatest common divisor;
+ * heavy task k of N gets Phase = P * k / N, and light task k of N gets P * (k + 1/2) / N, halfway
+ * between. Every run of a task then falls at the same point of some P-long window, so no two
+ * tasks of a kind coincide as long as P / N spans more than a frame. Phases are whole quanta and
+ * never repeat: when N exceeds the quanta in P they are bumped apart instead. Intervals that
+ * don't share a useful divisor fall back to the per-frame guard in the exporter.
+ */
+struct SATISFACTORYSPLUNKMOD_API FSplunkScheduler
+{
+    static constexpr float Quantum = 0.05f;
+
+    static void AssignPhases(TArray<FSplunkScheduleEntry>& Entries);
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Disk-backed spool for HEC batches that could not be delivered.
+ *
+ * Batches are appended as records to append-only segment files (spool_<seq>.seg) in one
+ * directory. Replay reads strictly oldest-first; a small cursor file remembers how far
+ * into the oldest segment replay has got so a restart does not resend delivered records.
+ * Segments are deleted once fully replayed, or evicted oldest-first when the spool
+ * would exceed its disk cap.
+ *
+ * Record layout: [Magic u32][Flags u32][Length u32][Crc32 u32][Length bytes]
+ *
+ * All methods are thread-safe.
+ */
+class SATISFACTORYSPLUNKMOD_API FSplunkSpool
+{
+public:
+    FSplunkSpool(const FString& InDirectory, int64 InMaxDiskBytes);
+
+    /** Scans existing segments left by a previous session and restores the replay cursor. */
+    void Open();
+
+    /** Appends one batch, evicting the oldest segments first if the disk cap would be exceeded. */
+    bool Append(const TArray<uint8>& Payload, bool bGzipped);
+
+    /** Reads the oldest undelivered batch without consuming it. */
+    bool PeekOldest(TArray<uint8>& OutPayload, bool& bOutGzipped);
+
+    /** Marks the batch returned by the last PeekOldest as delivered. */
+    void PopOldest();
+
+    bool IsEmpty() const;
+    int64 GetDiskBytes() const;
+
+    /** Number of segments dropped to stay under the disk cap since Open(). */
+    int32 GetEvictedSegments() const;
+
+    /** Number of batches successfully appended since Open(). */
+    int32 GetAppendedRecords() const;
+
+private:
+    struct FSegment
+    {
+        uint64 Seq = 0;
+        int64 Size = 0;
+    };
+
+    FString GetSegmentPath(uint64 Seq) const;
+    FString GetCursorPath() const;
+    void SaveCursor() const;
+    void DeleteOldestSegment();
+
+    FString Directory;
+    int64 MaxDiskBytes = 0;
+    int64 SegmentBytes = 0;
+
+    // Oldest first; the last entry is the segment currently appended to
+    TArray<FSegment> Segments;
+    int64 TotalBytes = 0;
+
+    // Replay position inside Segments[0], and size of the record last returned by PeekOldest
+    int64 ReadOffset = 0;
+    int64 PeekedRecordBytes = 0;
+
+    int32 EvictedSegments = 0;
+    int32 AppendedRecords = 0;
+
+    mutable FCriticalSection Lock;
+};
@@ -34,10 +34,14 @@ public class SatisfactorySplunkMod : ModuleRules
             new string[]
             {
                 "Slate",
-                "SlateCore"
+                "SlateCore",
+                "HTTPServer"
             }
         );
 
+        // Bundled zlib for gzip-compressed HEC payloads
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
         DynamicallyLoadedModuleNames.AddRange(
             new string[]
             {